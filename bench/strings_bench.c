@@ -0,0 +1,427 @@
+/*
+ * strings_bench.c
+ *
+ *  Created on: 19 oct. 2026
+ *      Author: Ludo
+ */
+
+#define _GNU_SOURCE
+
+#include "maths.h"
+#include "strings.h"
+#include "types.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+#if (defined __x86_64__) || (defined __i386__)
+#include <x86intrin.h>
+#endif
+
+/*** STRINGS BENCH local macros ***/
+
+#define STRINGS_BENCH_VALUES_NUMBER             4096
+#define STRINGS_BENCH_ARRAYS_NUMBER             64
+#define STRINGS_BENCH_ARRAY_SIZE_MAX            256
+#define STRINGS_BENCH_STRING_SIZE               40
+#define STRINGS_BENCH_DURATION_MS_DEFAULT       200
+#define STRINGS_BENCH_FLOATING_DIVIDER_EXPONENT 3
+#define STRINGS_BENCH_FLOATING_NUMBER_OF_DIGITS MATH_U32_SIZE_DECIMAL_DIGITS
+
+/*** STRINGS BENCH local structures ***/
+
+/*******************************************************************/
+typedef enum {
+    STRINGS_BENCH_CYCLES_SOURCE_NONE = 0,
+    STRINGS_BENCH_CYCLES_SOURCE_CORE,
+    STRINGS_BENCH_CYCLES_SOURCE_TSC,
+    STRINGS_BENCH_CYCLES_SOURCE_LAST
+} STRINGS_BENCH_cycles_source_t;
+
+/*******************************************************************/
+typedef void (*STRINGS_BENCH_run_cb_t)(uint32_t idx);
+
+/*******************************************************************/
+typedef struct {
+    char_t* name;
+    uint8_t number_of_digits_min;
+    uint8_t number_of_digits_max;
+    uint8_t signed_flag;
+} STRINGS_BENCH_distribution_t;
+
+/*******************************************************************/
+typedef struct {
+    char_t* name;
+    STRINGS_BENCH_run_cb_t string_callback;
+    STRINGS_BENCH_run_cb_t libc_callback;
+} STRINGS_BENCH_routine_t;
+
+/*******************************************************************/
+typedef struct {
+    uint64_t duration_ns;
+    uint64_t random_state;
+    STRINGS_BENCH_cycles_source_t cycles_source;
+    int cycles_fd;
+    volatile uint32_t sink;
+    int32_t values[STRINGS_BENCH_VALUES_NUMBER];
+    char_t decimal_strings[STRINGS_BENCH_VALUES_NUMBER][STRINGS_BENCH_STRING_SIZE];
+    uint8_t decimal_digits[STRINGS_BENCH_VALUES_NUMBER];
+    char_t hexadecimal_strings[STRINGS_BENCH_VALUES_NUMBER][STRINGS_BENCH_STRING_SIZE];
+    uint8_t hexadecimal_digits[STRINGS_BENCH_VALUES_NUMBER];
+    uint32_t array_size;
+    uint8_t arrays[STRINGS_BENCH_ARRAYS_NUMBER][STRINGS_BENCH_ARRAY_SIZE_MAX];
+    char_t array_strings[STRINGS_BENCH_ARRAYS_NUMBER][(2 * STRINGS_BENCH_ARRAY_SIZE_MAX) + 1];
+    char_t output[(2 * STRINGS_BENCH_ARRAY_SIZE_MAX) + 1];
+    uint8_t output_array[STRINGS_BENCH_ARRAY_SIZE_MAX];
+} STRINGS_BENCH_context_t;
+
+/*** STRINGS BENCH local global variables ***/
+
+static const STRINGS_BENCH_distribution_t STRINGS_BENCH_DISTRIBUTIONS[] = {
+    { "1 digit", 1, 1, 0 },
+    { "3 digits", 3, 3, 0 },
+    { "5 digits", 5, 5, 0 },
+    { "10 digits", 10, 10, 0 },
+    { "1-10 digits +/-", 1, 10, 1 },
+};
+
+static const char_t* STRINGS_BENCH_CYCLES_SOURCE_NAME[STRINGS_BENCH_CYCLES_SOURCE_LAST] = { "unavailable", "core cycles", "TSC reference cycles" };
+
+static const uint32_t STRINGS_BENCH_ARRAY_SIZES[] = { 4, 32, STRINGS_BENCH_ARRAY_SIZE_MAX };
+
+static STRINGS_BENCH_context_t strings_bench_ctx;
+
+/*** STRINGS BENCH local functions ***/
+
+/*******************************************************************/
+static uint32_t _STRINGS_BENCH_random(void) {
+    // Xorshift generator, the sequence is the same on each run.
+    strings_bench_ctx.random_state ^= (strings_bench_ctx.random_state << 13);
+    strings_bench_ctx.random_state ^= (strings_bench_ctx.random_state >> 7);
+    strings_bench_ctx.random_state ^= (strings_bench_ctx.random_state << 17);
+    return ((uint32_t) (strings_bench_ctx.random_state >> 32));
+}
+
+/*******************************************************************/
+static uint64_t _STRINGS_BENCH_get_time_ns(void) {
+    // Local variables.
+    struct timespec now;
+    // Read monotonic clock.
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return ((((uint64_t) now.tv_sec) * 1000000000ULL) + ((uint64_t) now.tv_nsec));
+}
+
+/*******************************************************************/
+static void _STRINGS_BENCH_init_cycles_counter(void) {
+    // Local variables.
+#ifdef __linux__
+    struct perf_event_attr attributes;
+#endif
+    // Default is no counter.
+    strings_bench_ctx.cycles_source = STRINGS_BENCH_CYCLES_SOURCE_NONE;
+    strings_bench_ctx.cycles_fd = -1;
+#ifdef __linux__
+    // Core cycles of the calling thread (requires the performance counters to be accessible).
+    memset(&attributes, 0, sizeof(struct perf_event_attr));
+    attributes.type = PERF_TYPE_HARDWARE;
+    attributes.size = sizeof(struct perf_event_attr);
+    attributes.config = PERF_COUNT_HW_CPU_CYCLES;
+    attributes.exclude_kernel = 1;
+    attributes.exclude_hv = 1;
+    strings_bench_ctx.cycles_fd = (int) syscall(SYS_perf_event_open, &attributes, 0, -1, -1, 0);
+    if (strings_bench_ctx.cycles_fd >= 0) {
+        strings_bench_ctx.cycles_source = STRINGS_BENCH_CYCLES_SOURCE_CORE;
+    }
+#endif
+#if (defined __x86_64__) || (defined __i386__)
+    // Otherwise use the time stamp counter, which runs at a constant rate which may differ from the core clock.
+    if (strings_bench_ctx.cycles_source == STRINGS_BENCH_CYCLES_SOURCE_NONE) {
+        strings_bench_ctx.cycles_source = STRINGS_BENCH_CYCLES_SOURCE_TSC;
+    }
+#endif
+}
+
+/*******************************************************************/
+static uint64_t _STRINGS_BENCH_get_cycles(void) {
+    // Local variables.
+    uint64_t cycles = 0;
+    // Read selected counter.
+    switch (strings_bench_ctx.cycles_source) {
+#ifdef __linux__
+    case STRINGS_BENCH_CYCLES_SOURCE_CORE:
+        if (read(strings_bench_ctx.cycles_fd, &cycles, sizeof(uint64_t)) != sizeof(uint64_t)) {
+            cycles = 0;
+        }
+        break;
+#endif
+#if (defined __x86_64__) || (defined __i386__)
+    case STRINGS_BENCH_CYCLES_SOURCE_TSC:
+        cycles = __rdtsc();
+        break;
+#endif
+    default:
+        break;
+    }
+    return cycles;
+}
+
+/*******************************************************************/
+static void _STRINGS_BENCH_generate_values(const STRINGS_BENCH_distribution_t* distribution) {
+    // Local variables.
+    STRING_status_t string_status = STRING_SUCCESS;
+    uint64_t value_min = 0;
+    uint64_t value_max = 0;
+    uint64_t value = 0;
+    uint8_t number_of_digits = 0;
+    uint32_t idx = 0;
+    // Values loop.
+    for (idx = 0; idx < STRINGS_BENCH_VALUES_NUMBER; idx++) {
+        // Draw number of digits then value.
+        number_of_digits = (uint8_t) ((distribution->number_of_digits_min) + (_STRINGS_BENCH_random() % ((distribution->number_of_digits_max) - (distribution->number_of_digits_min) + 1)));
+        value_min = (number_of_digits > 1) ? MATH_POWER_10[number_of_digits - 1] : 0;
+        value_max = (number_of_digits < MATH_U32_SIZE_DECIMAL_DIGITS) ? (MATH_POWER_10[number_of_digits] - 1) : MATH_S32_MAX;
+        value = value_min + ((((uint64_t) _STRINGS_BENCH_random() << 32) | _STRINGS_BENCH_random()) % (value_max - value_min + 1));
+        strings_bench_ctx.values[idx] = (int32_t) value;
+        if (((distribution->signed_flag) != 0) && ((_STRINGS_BENCH_random() & 0x01) != 0)) {
+            strings_bench_ctx.values[idx] = (0 - strings_bench_ctx.values[idx]);
+        }
+        // Build input strings of the parsing routines.
+        string_status = STRING_integer_to_string(strings_bench_ctx.values[idx], STRING_FORMAT_DECIMAL, 0, strings_bench_ctx.decimal_strings[idx]);
+        string_status |= STRING_integer_to_string(strings_bench_ctx.values[idx], STRING_FORMAT_HEXADECIMAL, 0, strings_bench_ctx.hexadecimal_strings[idx]);
+        if (string_status != STRING_SUCCESS) {
+            fprintf(stderr, "STRING_integer_to_string() failed for %ld\n", (long) strings_bench_ctx.values[idx]);
+            exit(EXIT_FAILURE);
+        }
+        strings_bench_ctx.decimal_digits[idx] = (uint8_t) (strlen(strings_bench_ctx.decimal_strings[idx]) - (strings_bench_ctx.values[idx] < 0));
+        strings_bench_ctx.hexadecimal_digits[idx] = (uint8_t) (strlen(strings_bench_ctx.hexadecimal_strings[idx]) - (strings_bench_ctx.values[idx] < 0));
+    }
+}
+
+/*******************************************************************/
+static void _STRINGS_BENCH_generate_arrays(uint32_t array_size) {
+    // Local variables.
+    STRING_status_t string_status = STRING_SUCCESS;
+    uint32_t idx = 0;
+    uint32_t byte_idx = 0;
+    // Arrays loop.
+    strings_bench_ctx.array_size = array_size;
+    for (idx = 0; idx < STRINGS_BENCH_ARRAYS_NUMBER; idx++) {
+        for (byte_idx = 0; byte_idx < array_size; byte_idx++) {
+            strings_bench_ctx.arrays[idx][byte_idx] = (uint8_t) _STRINGS_BENCH_random();
+        }
+        string_status = STRING_byte_array_to_hexadecimal_string(strings_bench_ctx.arrays[idx], array_size, 0, strings_bench_ctx.array_strings[idx]);
+        if (string_status != STRING_SUCCESS) {
+            fprintf(stderr, "STRING_byte_array_to_hexadecimal_string() failed\n");
+            exit(EXIT_FAILURE);
+        }
+    }
+}
+
+/*******************************************************************/
+static float64_t _STRINGS_BENCH_measure(STRINGS_BENCH_run_cb_t run_callback, uint32_t number_of_items, float64_t* cycles_per_operation) {
+    // Local variables.
+    uint64_t start_cycles = 0;
+    uint64_t start_time_ns = 0;
+    uint64_t elapsed_time_ns = 0;
+    uint64_t number_of_operations = 0;
+    uint32_t idx = 0;
+    // Warm-up pass.
+    for (idx = 0; idx < number_of_items; idx++) {
+        run_callback(idx);
+    }
+    // Run complete passes until the duration is reached.
+    start_cycles = _STRINGS_BENCH_get_cycles();
+    start_time_ns = _STRINGS_BENCH_get_time_ns();
+    do {
+        for (idx = 0; idx < number_of_items; idx++) {
+            run_callback(idx);
+        }
+        number_of_operations += number_of_items;
+        elapsed_time_ns = (_STRINGS_BENCH_get_time_ns() - start_time_ns);
+    }
+    while (elapsed_time_ns < strings_bench_ctx.duration_ns);
+    if (cycles_per_operation != NULL) {
+        (*cycles_per_operation) = (((float64_t) (_STRINGS_BENCH_get_cycles() - start_cycles)) / ((float64_t) number_of_operations));
+    }
+    return (((float64_t) elapsed_time_ns) / ((float64_t) number_of_operations));
+}
+
+/*******************************************************************/
+static void _STRINGS_BENCH_print_result(const STRINGS_BENCH_routine_t* routine, char_t* distribution_name, uint32_t number_of_items) {
+    // Local variables.
+    float64_t string_ns = _STRINGS_BENCH_measure((routine->string_callback), number_of_items, NULL);
+    float64_t libc_ns = _STRINGS_BENCH_measure((routine->libc_callback), number_of_items, NULL);
+    // Print line.
+    printf("%-42s %-16s %10.1f %10.1f %8.2f\n", (routine->name), distribution_name, string_ns, libc_ns, (string_ns / libc_ns));
+}
+
+/*******************************************************************/
+static void _STRINGS_BENCH_print_cycles_result(const STRINGS_BENCH_routine_t* routine, char_t* distribution_name, uint32_t number_of_items) {
+    // Local variables.
+    float64_t string_cycles = 0.0;
+    float64_t libc_cycles = 0.0;
+    float64_t string_ns = _STRINGS_BENCH_measure((routine->string_callback), number_of_items, &string_cycles);
+    float64_t libc_ns = _STRINGS_BENCH_measure((routine->libc_callback), number_of_items, &libc_cycles);
+    // Print line.
+    printf("%-42s %-16s %10.1f %12.1f %10.1f %12.1f\n", (routine->name), distribution_name, string_ns, string_cycles, libc_ns, libc_cycles);
+}
+
+/*******************************************************************/
+static void _STRINGS_BENCH_integer_to_string_decimal(uint32_t idx) {
+    STRING_integer_to_string(strings_bench_ctx.values[idx], STRING_FORMAT_DECIMAL, 0, strings_bench_ctx.output);
+    strings_bench_ctx.sink += (uint32_t) strings_bench_ctx.output[0];
+}
+
+/*******************************************************************/
+static void _STRINGS_BENCH_snprintf_decimal(uint32_t idx) {
+    snprintf(strings_bench_ctx.output, STRINGS_BENCH_STRING_SIZE, "%ld", (long) strings_bench_ctx.values[idx]);
+    strings_bench_ctx.sink += (uint32_t) strings_bench_ctx.output[0];
+}
+
+/*******************************************************************/
+static void _STRINGS_BENCH_integer_to_string_hexadecimal(uint32_t idx) {
+    STRING_integer_to_string(strings_bench_ctx.values[idx], STRING_FORMAT_HEXADECIMAL, 0, strings_bench_ctx.output);
+    strings_bench_ctx.sink += (uint32_t) strings_bench_ctx.output[0];
+}
+
+/*******************************************************************/
+static void _STRINGS_BENCH_snprintf_hexadecimal(uint32_t idx) {
+    snprintf(strings_bench_ctx.output, STRINGS_BENCH_STRING_SIZE, "%lx", (unsigned long) ((uint32_t) strings_bench_ctx.values[idx]));
+    strings_bench_ctx.sink += (uint32_t) strings_bench_ctx.output[0];
+}
+
+/*******************************************************************/
+static void _STRINGS_BENCH_string_to_integer_decimal(uint32_t idx) {
+    int32_t value = 0;
+    STRING_string_to_integer(strings_bench_ctx.decimal_strings[idx], STRING_FORMAT_DECIMAL, strings_bench_ctx.decimal_digits[idx], &value);
+    strings_bench_ctx.sink += (uint32_t) value;
+}
+
+/*******************************************************************/
+static void _STRINGS_BENCH_strtol_decimal(uint32_t idx) {
+    strings_bench_ctx.sink += (uint32_t) strtol(strings_bench_ctx.decimal_strings[idx], NULL, 10);
+}
+
+/*******************************************************************/
+static void _STRINGS_BENCH_string_to_integer_hexadecimal(uint32_t idx) {
+    int32_t value = 0;
+    STRING_string_to_integer(strings_bench_ctx.hexadecimal_strings[idx], STRING_FORMAT_HEXADECIMAL, strings_bench_ctx.hexadecimal_digits[idx], &value);
+    strings_bench_ctx.sink += (uint32_t) value;
+}
+
+/*******************************************************************/
+static void _STRINGS_BENCH_strtol_hexadecimal(uint32_t idx) {
+    strings_bench_ctx.sink += (uint32_t) strtol(strings_bench_ctx.hexadecimal_strings[idx], NULL, 16);
+}
+
+/*******************************************************************/
+static void _STRINGS_BENCH_integer_to_floating_decimal_string(uint32_t idx) {
+    STRING_integer_to_floating_decimal_string(strings_bench_ctx.values[idx], STRINGS_BENCH_FLOATING_DIVIDER_EXPONENT, STRINGS_BENCH_FLOATING_NUMBER_OF_DIGITS, strings_bench_ctx.output);
+    strings_bench_ctx.sink += (uint32_t) strings_bench_ctx.output[0];
+}
+
+/*******************************************************************/
+static void _STRINGS_BENCH_snprintf_floating_decimal(uint32_t idx) {
+    snprintf(strings_bench_ctx.output, STRINGS_BENCH_STRING_SIZE, "%.*f", STRINGS_BENCH_FLOATING_DIVIDER_EXPONENT, (((float64_t) strings_bench_ctx.values[idx]) / MATH_POWER_10[STRINGS_BENCH_FLOATING_DIVIDER_EXPONENT]));
+    strings_bench_ctx.sink += (uint32_t) strings_bench_ctx.output[0];
+}
+
+/*******************************************************************/
+static void _STRINGS_BENCH_byte_array_to_hexadecimal_string(uint32_t idx) {
+    STRING_byte_array_to_hexadecimal_string(strings_bench_ctx.arrays[idx], strings_bench_ctx.array_size, 0, strings_bench_ctx.output);
+    strings_bench_ctx.sink += (uint32_t) strings_bench_ctx.output[0];
+}
+
+/*******************************************************************/
+static void _STRINGS_BENCH_snprintf_byte_array(uint32_t idx) {
+    uint32_t byte_idx = 0;
+    for (byte_idx = 0; byte_idx < strings_bench_ctx.array_size; byte_idx++) {
+        snprintf(&(strings_bench_ctx.output[byte_idx << 1]), 3, "%02x", strings_bench_ctx.arrays[idx][byte_idx]);
+    }
+    strings_bench_ctx.sink += (uint32_t) strings_bench_ctx.output[0];
+}
+
+/*******************************************************************/
+static void _STRINGS_BENCH_hexadecimal_string_to_byte_array(uint32_t idx) {
+    uint32_t extracted_size = 0;
+    STRING_hexadecimal_string_to_byte_array(strings_bench_ctx.array_strings[idx], STRING_CHAR_NULL, strings_bench_ctx.output_array, &extracted_size);
+    strings_bench_ctx.sink += strings_bench_ctx.output_array[0];
+}
+
+/*******************************************************************/
+static void _STRINGS_BENCH_sscanf_byte_array(uint32_t idx) {
+    uint32_t byte_idx = 0;
+    for (byte_idx = 0; byte_idx < strings_bench_ctx.array_size; byte_idx++) {
+        sscanf(&(strings_bench_ctx.array_strings[idx][byte_idx << 1]), "%2hhx", &(strings_bench_ctx.output_array[byte_idx]));
+    }
+    strings_bench_ctx.sink += strings_bench_ctx.output_array[0];
+}
+
+/*** STRINGS BENCH routines ***/
+
+static const STRINGS_BENCH_routine_t STRINGS_BENCH_INTEGER_ROUTINES[] = {
+    { "STRING_integer_to_string (decimal)", &_STRINGS_BENCH_integer_to_string_decimal, &_STRINGS_BENCH_snprintf_decimal },
+    { "STRING_integer_to_string (hexadecimal)", &_STRINGS_BENCH_integer_to_string_hexadecimal, &_STRINGS_BENCH_snprintf_hexadecimal },
+    { "STRING_string_to_integer (decimal)", &_STRINGS_BENCH_string_to_integer_decimal, &_STRINGS_BENCH_strtol_decimal },
+    { "STRING_string_to_integer (hexadecimal)", &_STRINGS_BENCH_string_to_integer_hexadecimal, &_STRINGS_BENCH_strtol_hexadecimal },
+    { "STRING_integer_to_floating_decimal_string", &_STRINGS_BENCH_integer_to_floating_decimal_string, &_STRINGS_BENCH_snprintf_floating_decimal },
+};
+
+static const STRINGS_BENCH_routine_t STRINGS_BENCH_ARRAY_ROUTINES[] = {
+    { "STRING_byte_array_to_hexadecimal_string", &_STRINGS_BENCH_byte_array_to_hexadecimal_string, &_STRINGS_BENCH_snprintf_byte_array },
+    { "STRING_hexadecimal_string_to_byte_array", &_STRINGS_BENCH_hexadecimal_string_to_byte_array, &_STRINGS_BENCH_sscanf_byte_array },
+};
+
+/*** STRINGS BENCH functions ***/
+
+/*******************************************************************/
+int main(int argc, char* argv[]) {
+    // Local variables.
+    STRINGS_BENCH_distribution_t distribution;
+    char_t distribution_name[STRINGS_BENCH_STRING_SIZE];
+    uint32_t duration_ms = STRINGS_BENCH_DURATION_MS_DEFAULT;
+    uint32_t idx = 0;
+    uint32_t routine_idx = 0;
+    // Optional measure duration of each routine.
+    if (argc > 1) {
+        duration_ms = (uint32_t) strtoul(argv[1], NULL, 10);
+    }
+    strings_bench_ctx.duration_ns = (((uint64_t) duration_ms) * 1000000ULL);
+    strings_bench_ctx.random_state = 0x9E3779B97F4A7C15ULL;
+    _STRINGS_BENCH_init_cycles_counter();
+    // Header.
+    printf("%-42s %-16s %10s %10s %8s\n", "routine", "distribution", "ns/op", "libc ns/op", "ratio");
+    // Integer routines.
+    for (idx = 0; idx < (sizeof(STRINGS_BENCH_DISTRIBUTIONS) / sizeof(STRINGS_BENCH_distribution_t)); idx++) {
+        _STRINGS_BENCH_generate_values(&(STRINGS_BENCH_DISTRIBUTIONS[idx]));
+        for (routine_idx = 0; routine_idx < (sizeof(STRINGS_BENCH_INTEGER_ROUTINES) / sizeof(STRINGS_BENCH_routine_t)); routine_idx++) {
+            _STRINGS_BENCH_print_result(&(STRINGS_BENCH_INTEGER_ROUTINES[routine_idx]), (STRINGS_BENCH_DISTRIBUTIONS[idx].name), STRINGS_BENCH_VALUES_NUMBER);
+        }
+    }
+    // Byte array routines.
+    for (idx = 0; idx < (sizeof(STRINGS_BENCH_ARRAY_SIZES) / sizeof(uint32_t)); idx++) {
+        _STRINGS_BENCH_generate_arrays(STRINGS_BENCH_ARRAY_SIZES[idx]);
+        snprintf(distribution_name, STRINGS_BENCH_STRING_SIZE, "%lu bytes", (unsigned long) STRINGS_BENCH_ARRAY_SIZES[idx]);
+        for (routine_idx = 0; routine_idx < (sizeof(STRINGS_BENCH_ARRAY_ROUTINES) / sizeof(STRINGS_BENCH_routine_t)); routine_idx++) {
+            _STRINGS_BENCH_print_result(&(STRINGS_BENCH_ARRAY_ROUTINES[routine_idx]), distribution_name, STRINGS_BENCH_ARRAYS_NUMBER);
+        }
+    }
+    // Decimal formatting cost per number of digits.
+    printf("\n%-42s %-16s %10s %12s %10s %12s (%s)\n", "routine", "distribution", "ns/op", "cycles/op", "libc ns/op", "libc cyc/op", STRINGS_BENCH_CYCLES_SOURCE_NAME[strings_bench_ctx.cycles_source]);
+    distribution.name = distribution_name;
+    distribution.signed_flag = 0;
+    for (idx = 1; idx <= MATH_U32_SIZE_DECIMAL_DIGITS; idx++) {
+        distribution.number_of_digits_min = (uint8_t) idx;
+        distribution.number_of_digits_max = (uint8_t) idx;
+        snprintf(distribution_name, STRINGS_BENCH_STRING_SIZE, "%lu digit%s", (unsigned long) idx, ((idx > 1) ? "s" : ""));
+        _STRINGS_BENCH_generate_values(&distribution);
+        _STRINGS_BENCH_print_cycles_result(&(STRINGS_BENCH_INTEGER_ROUTINES[0]), distribution_name, STRINGS_BENCH_VALUES_NUMBER);
+    }
+    return EXIT_SUCCESS;
+}
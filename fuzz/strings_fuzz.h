@@ -0,0 +1,41 @@
+/*
+ * strings_fuzz.h
+ *
+ *  Created on: 19 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __STRINGS_FUZZ_H__
+#define __STRINGS_FUZZ_H__
+
+#include "types.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+/*** STRINGS FUZZ macros ***/
+
+/*!******************************************************************
+ * \fn STRINGS_FUZZ_check(condition)
+ * \brief Abort the fuzzing session if a round-trip assertion is not verified (active whatever the build type).
+ *******************************************************************/
+#define STRINGS_FUZZ_check(condition) { \
+    if (!(condition)) { \
+        fprintf(stderr, "%s:%d: assertion failed: %s\n", __FILE__, __LINE__, #condition); \
+        abort(); \
+    } \
+}
+
+/*** STRINGS FUZZ functions ***/
+
+/*!******************************************************************
+ * \fn int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size)
+ * \brief Fuzzing entry point, called by libFuzzer or by the replay driver with each input.
+ * \param[in]   data: Input bytes.
+ * \param[in]   size: Number of input bytes.
+ * \param[out]  none
+ * \retval      Always 0.
+ *******************************************************************/
+int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size);
+
+#endif /* __STRINGS_FUZZ_H__ */
@@ -0,0 +1,80 @@
+/*
+ * strings_fuzz_floating_decimal.c
+ *
+ *  Created on: 19 oct. 2026
+ *      Author: Ludo
+ */
+
+#include "strings_fuzz.h"
+
+#include "maths.h"
+#include "strings.h"
+#include "types.h"
+
+#include <string.h>
+
+/*** STRINGS FUZZ FLOATING DECIMAL local macros ***/
+
+#define STRINGS_FUZZ_FLOATING_DECIMAL_STRING_SIZE   48
+
+/*** STRINGS FUZZ FLOATING DECIMAL local functions ***/
+
+/*******************************************************************/
+static void _STRINGS_FUZZ_FLOATING_DECIMAL_check_value(int32_t value, uint8_t divider_exponent, uint8_t number_of_digits) {
+    // Local variables.
+    STRING_status_t string_status = STRING_SUCCESS;
+    char_t str[STRINGS_FUZZ_FLOATING_DECIMAL_STRING_SIZE];
+    char_t* dot = NULL;
+    int32_t result = 0;
+    int64_t expected = 0;
+    uint32_t str_size = 0;
+    uint8_t number_of_decimals = 0;
+    // The conversion does not end the string.
+    memset(str, STRING_CHAR_NULL, STRINGS_FUZZ_FLOATING_DECIMAL_STRING_SIZE);
+    string_status = STRING_integer_to_floating_decimal_string(value, divider_exponent, number_of_digits, str);
+    if (string_status != STRING_SUCCESS) goto end;
+    str_size = (uint32_t) strlen(str);
+    STRINGS_FUZZ_check((str_size > 0) && (str_size <= number_of_digits));
+    // Decimals which do not fit in the number of digits are truncated, remaining digits are padded with zeros.
+    dot = strchr(str, STRING_CHAR_DOT);
+    number_of_decimals = (dot == NULL) ? 0 : (uint8_t) (str_size - (uint32_t) (dot - str) - 1);
+    expected = value;
+    if (number_of_decimals < divider_exponent) {
+        expected = (expected / MATH_POWER_10[divider_exponent - number_of_decimals]) * MATH_POWER_10[divider_exponent - number_of_decimals];
+    }
+    // Read back the string with the same exponent.
+    string_status = STRING_floating_decimal_string_to_integer(str, str_size, divider_exponent, &result);
+    STRINGS_FUZZ_check(string_status == STRING_SUCCESS);
+    STRINGS_FUZZ_check(result == expected);
+end:
+    return;
+}
+
+/*** STRINGS FUZZ FLOATING DECIMAL functions ***/
+
+/*******************************************************************/
+int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size) {
+    // Local variables.
+    STRING_status_t string_status = STRING_SUCCESS;
+    char_t str[STRINGS_FUZZ_FLOATING_DECIMAL_STRING_SIZE];
+    int32_t value = 0;
+    uint8_t divider_exponent = 0;
+    size_t str_size = 0;
+    // First bytes select the exponent and the number of digits.
+    if (size < 2) goto end;
+    divider_exponent = (uint8_t) (data[0] % MATH_U32_SIZE_DECIMAL_DIGITS);
+    // Value round-trip.
+    if (size >= (2 + sizeof(int32_t))) {
+        memcpy(&value, &(data[2]), sizeof(int32_t));
+        _STRINGS_FUZZ_FLOATING_DECIMAL_check_value(value, divider_exponent, (uint8_t) (data[1] % (MATH_U32_SIZE_DECIMAL_DIGITS + 1)));
+    }
+    // String round-trip: any accepted value is printed and read back.
+    str_size = ((size - 2) < STRINGS_FUZZ_FLOATING_DECIMAL_STRING_SIZE) ? (size - 2) : STRINGS_FUZZ_FLOATING_DECIMAL_STRING_SIZE;
+    memcpy(str, &(data[2]), str_size);
+    string_status = STRING_floating_decimal_string_to_integer(str, (uint32_t) str_size, divider_exponent, &value);
+    if (string_status == STRING_SUCCESS) {
+        _STRINGS_FUZZ_FLOATING_DECIMAL_check_value(value, divider_exponent, MATH_U32_SIZE_DECIMAL_DIGITS);
+    }
+end:
+    return 0;
+}
@@ -0,0 +1,94 @@
+/*
+ * strings_fuzz_hexadecimal.c
+ *
+ *  Created on: 19 oct. 2026
+ *      Author: Ludo
+ */
+
+#include "strings_fuzz.h"
+
+#include "strings.h"
+#include "types.h"
+
+#include <ctype.h>
+#include <string.h>
+
+/*** STRINGS FUZZ HEXADECIMAL local macros ***/
+
+#define STRINGS_FUZZ_HEXADECIMAL_DATA_SIZE_MAX  256
+
+/*** STRINGS FUZZ HEXADECIMAL local global variables ***/
+
+static const char_t STRINGS_FUZZ_HEXADECIMAL_END_CHARACTERS[] = { STRING_CHAR_NULL, STRING_CHAR_COMMA, 'F' };
+
+/*** STRINGS FUZZ HEXADECIMAL local functions ***/
+
+/*******************************************************************/
+static uint8_t _STRINGS_FUZZ_HEXADECIMAL_compare(char_t* str_1, char_t* str_2, uint32_t size) {
+    // Local variables.
+    uint32_t idx = 0;
+    // Case is not significant.
+    for (idx = 0; idx < size; idx++) {
+        if (tolower((unsigned char) str_1[idx]) != tolower((unsigned char) str_2[idx])) return 0;
+    }
+    return 1;
+}
+
+/*******************************************************************/
+static void _STRINGS_FUZZ_HEXADECIMAL_check_data(const uint8_t* data, uint32_t data_size_bytes, uint8_t offset) {
+    // Local variables.
+    STRING_status_t string_status = STRING_SUCCESS;
+    char_t str[(2 * STRINGS_FUZZ_HEXADECIMAL_DATA_SIZE_MAX) + 2 + sizeof(uint32_t) + 1];
+    uint8_t result[STRINGS_FUZZ_HEXADECIMAL_DATA_SIZE_MAX];
+    uint32_t extracted_size = 0;
+    // Encode with prefix at any alignment.
+    string_status = STRING_byte_array_to_hexadecimal_string((uint8_t*) data, data_size_bytes, 1, &(str[offset]));
+    STRINGS_FUZZ_check(string_status == STRING_SUCCESS);
+    STRINGS_FUZZ_check(strlen(&(str[offset])) == ((2 * data_size_bytes) + 2));
+    // Decode without prefix.
+    string_status = STRING_hexadecimal_string_to_byte_array(&(str[offset + 2]), STRING_CHAR_NULL, result, &extracted_size);
+    STRINGS_FUZZ_check(string_status == STRING_SUCCESS);
+    STRINGS_FUZZ_check(extracted_size == data_size_bytes);
+    STRINGS_FUZZ_check(memcmp(data, result, data_size_bytes) == 0);
+}
+
+/*******************************************************************/
+static void _STRINGS_FUZZ_HEXADECIMAL_check_string(char_t* str, char_t end_character) {
+    // Local variables.
+    STRING_status_t string_status = STRING_SUCCESS;
+    char_t result[(2 * STRINGS_FUZZ_HEXADECIMAL_DATA_SIZE_MAX) + 1];
+    uint8_t data[STRINGS_FUZZ_HEXADECIMAL_DATA_SIZE_MAX];
+    uint32_t extracted_size = 0;
+    // Any string accepted by the decoder is encoded back to the same digits.
+    string_status = STRING_hexadecimal_string_to_byte_array(str, end_character, data, &extracted_size);
+    if (string_status != STRING_SUCCESS) goto end;
+    _STRINGS_FUZZ_HEXADECIMAL_check_data(data, extracted_size, 0);
+    string_status = STRING_byte_array_to_hexadecimal_string(data, extracted_size, 0, result);
+    STRINGS_FUZZ_check(string_status == STRING_SUCCESS);
+    STRINGS_FUZZ_check(_STRINGS_FUZZ_HEXADECIMAL_compare(str, result, (2 * extracted_size)) != 0);
+    STRINGS_FUZZ_check((str[2 * extracted_size] == end_character) || (str[2 * extracted_size] == STRING_CHAR_NULL));
+end:
+    return;
+}
+
+/*** STRINGS FUZZ HEXADECIMAL functions ***/
+
+/*******************************************************************/
+int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size) {
+    // Local variables.
+    char_t str[(2 * STRINGS_FUZZ_HEXADECIMAL_DATA_SIZE_MAX) + sizeof(uint32_t) + 1];
+    uint32_t data_size_bytes = 0;
+    uint8_t offset = 0;
+    // First byte selects the string alignment and the end character (a digit end character disables the word conversion).
+    if (size < 1) goto end;
+    data_size_bytes = (uint32_t) (((size - 1) < STRINGS_FUZZ_HEXADECIMAL_DATA_SIZE_MAX) ? (size - 1) : STRINGS_FUZZ_HEXADECIMAL_DATA_SIZE_MAX);
+    offset = (uint8_t) (data[0] % sizeof(uint32_t));
+    // Bytes round-trip.
+    _STRINGS_FUZZ_HEXADECIMAL_check_data(&(data[1]), data_size_bytes, offset);
+    // String round-trip.
+    memcpy(&(str[offset]), &(data[1]), data_size_bytes);
+    str[offset + data_size_bytes] = STRING_CHAR_NULL;
+    _STRINGS_FUZZ_HEXADECIMAL_check_string(&(str[offset]), STRINGS_FUZZ_HEXADECIMAL_END_CHARACTERS[(data[0] >> 2) % (sizeof(STRINGS_FUZZ_HEXADECIMAL_END_CHARACTERS) / sizeof(char_t))]);
+end:
+    return 0;
+}
@@ -0,0 +1,91 @@
+/*
+ * strings_fuzz_integer.c
+ *
+ *  Created on: 19 oct. 2026
+ *      Author: Ludo
+ */
+
+#include "strings_fuzz.h"
+
+#include "strings.h"
+#include "types.h"
+
+#include <string.h>
+
+/*** STRINGS FUZZ INTEGER local macros ***/
+
+#define STRINGS_FUZZ_INTEGER_STRING_SIZE    48
+
+/*** STRINGS FUZZ INTEGER local functions ***/
+
+/*******************************************************************/
+static void _STRINGS_FUZZ_INTEGER_check_value(int32_t value) {
+    // Local variables.
+    STRING_status_t string_status = STRING_SUCCESS;
+    char_t str[STRINGS_FUZZ_INTEGER_STRING_SIZE];
+    STRING_format_t format = STRING_FORMAT_BOOLEAN;
+    int32_t result = 0;
+    uint32_t parsed_size = 0;
+    uint8_t number_of_digits = 0;
+    // Formats loop.
+    for (format = STRING_FORMAT_BOOLEAN; format < STRING_FORMAT_LAST; format++) {
+        // Value to string and back with the same format.
+        string_status = STRING_integer_to_string(value, format, 0, str);
+        STRINGS_FUZZ_check(string_status == STRING_SUCCESS);
+        number_of_digits = (uint8_t) (strlen(str) - (value < 0));
+        if (format != STRING_FORMAT_BOOLEAN) {
+            string_status = STRING_string_to_integer(str, format, number_of_digits, &result);
+            STRINGS_FUZZ_check(string_status == STRING_SUCCESS);
+            STRINGS_FUZZ_check(result == value);
+        }
+        // Prefixed string is detected by the parser.
+        string_status = STRING_integer_to_string(value, format, 1, str);
+        STRINGS_FUZZ_check(string_status == STRING_SUCCESS);
+        string_status = STRING_parse_integer(str, STRINGS_FUZZ_INTEGER_STRING_SIZE, &result, &parsed_size);
+        STRINGS_FUZZ_check(string_status == STRING_SUCCESS);
+        STRINGS_FUZZ_check(result == value);
+        STRINGS_FUZZ_check(parsed_size == strlen(str));
+    }
+}
+
+/*******************************************************************/
+static void _STRINGS_FUZZ_INTEGER_check_string(char_t* str, STRING_format_t format, uint8_t number_of_digits) {
+    // Local variables.
+    STRING_status_t string_status = STRING_SUCCESS;
+    int32_t value = 0;
+    uint32_t parsed_size = 0;
+    // Any value accepted by the conversion functions must survive a round-trip.
+    string_status = STRING_string_to_integer(str, format, number_of_digits, &value);
+    if (string_status == STRING_SUCCESS) {
+        _STRINGS_FUZZ_INTEGER_check_value(value);
+    }
+    string_status = STRING_parse_integer(str, (uint32_t) strlen(str), &value, &parsed_size);
+    if (string_status == STRING_SUCCESS) {
+        STRINGS_FUZZ_check(parsed_size <= strlen(str));
+        _STRINGS_FUZZ_INTEGER_check_value(value);
+    }
+}
+
+/*** STRINGS FUZZ INTEGER functions ***/
+
+/*******************************************************************/
+int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size) {
+    // Local variables.
+    char_t str[STRINGS_FUZZ_INTEGER_STRING_SIZE];
+    int32_t value = 0;
+    size_t str_size = 0;
+    // First byte selects the format and the number of digits of the string conversion.
+    if (size < 1) goto end;
+    // Value round-trip.
+    if (size >= (1 + sizeof(int32_t))) {
+        memcpy(&value, &(data[1]), sizeof(int32_t));
+        _STRINGS_FUZZ_INTEGER_check_value(value);
+    }
+    // String round-trip.
+    str_size = ((size - 1) < (STRINGS_FUZZ_INTEGER_STRING_SIZE - 1)) ? (size - 1) : (STRINGS_FUZZ_INTEGER_STRING_SIZE - 1);
+    memcpy(str, &(data[1]), str_size);
+    str[str_size] = STRING_CHAR_NULL;
+    _STRINGS_FUZZ_INTEGER_check_string(str, (STRING_format_t) (data[0] % STRING_FORMAT_LAST), (uint8_t) ((data[0] >> 2) % (str_size + 1)));
+end:
+    return 0;
+}
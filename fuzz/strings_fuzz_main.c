@@ -0,0 +1,91 @@
+/*
+ * strings_fuzz_main.c
+ *
+ *  Created on: 19 oct. 2026
+ *      Author: Ludo
+ */
+
+#include "strings_fuzz.h"
+
+#include "types.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*** STRINGS FUZZ MAIN local macros ***/
+
+#define STRINGS_FUZZ_MAIN_INPUT_SIZE_MAX    4096
+#define STRINGS_FUZZ_MAIN_RANDOM_SIZE_MAX   64
+#define STRINGS_FUZZ_MAIN_RUNS_DEFAULT      1000000
+
+/*** STRINGS FUZZ MAIN local global variables ***/
+
+// Characters drawn more often than raw bytes to reach the conversion code paths.
+static const char_t STRINGS_FUZZ_MAIN_CHARACTERS[] = "0123456789abcdefABCDEF-+.,eExXbBdD";
+
+static uint8_t strings_fuzz_main_input[STRINGS_FUZZ_MAIN_INPUT_SIZE_MAX];
+static uint64_t strings_fuzz_main_random_state = 0x9E3779B97F4A7C15ULL;
+
+/*** STRINGS FUZZ MAIN local functions ***/
+
+/*******************************************************************/
+static uint8_t _STRINGS_FUZZ_MAIN_random(void) {
+    // Xorshift generator, the sequence is the same on each run.
+    strings_fuzz_main_random_state ^= (strings_fuzz_main_random_state << 13);
+    strings_fuzz_main_random_state ^= (strings_fuzz_main_random_state >> 7);
+    strings_fuzz_main_random_state ^= (strings_fuzz_main_random_state << 17);
+    return ((uint8_t) (strings_fuzz_main_random_state >> 56));
+}
+
+/*******************************************************************/
+static void _STRINGS_FUZZ_MAIN_run_file(char_t* file_name) {
+    // Local variables.
+    FILE* file = NULL;
+    size_t size = 0;
+    // Read whole input.
+    file = fopen(file_name, "rb");
+    if (file == NULL) {
+        fprintf(stderr, "Cannot open %s\n", file_name);
+        exit(EXIT_FAILURE);
+    }
+    size = fread(strings_fuzz_main_input, 1, STRINGS_FUZZ_MAIN_INPUT_SIZE_MAX, file);
+    fclose(file);
+    LLVMFuzzerTestOneInput(strings_fuzz_main_input, size);
+}
+
+/*** STRINGS FUZZ MAIN functions ***/
+
+/*******************************************************************/
+int main(int argc, char* argv[]) {
+    // Local variables.
+    uint32_t runs = STRINGS_FUZZ_MAIN_RUNS_DEFAULT;
+    uint32_t run_idx = 0;
+    size_t size = 0;
+    size_t idx = 0;
+    int arg_idx = 0;
+    // Replay the given inputs (for example a libFuzzer corpus or crash file).
+    if ((argc > 1) && (strncmp(argv[1], "-runs=", 6) != 0)) {
+        for (arg_idx = 1; arg_idx < argc; arg_idx++) {
+            _STRINGS_FUZZ_MAIN_run_file(argv[arg_idx]);
+        }
+        goto end;
+    }
+    // Otherwise run random inputs when libFuzzer is not available.
+    if (argc > 1) {
+        runs = (uint32_t) strtoul(&(argv[1][6]), NULL, 10);
+    }
+    for (run_idx = 0; run_idx < runs; run_idx++) {
+        size = (_STRINGS_FUZZ_MAIN_random() % (STRINGS_FUZZ_MAIN_RANDOM_SIZE_MAX + 1));
+        for (idx = 0; idx < size; idx++) {
+            strings_fuzz_main_input[idx] = _STRINGS_FUZZ_MAIN_random();
+            if ((strings_fuzz_main_input[idx] & 0x01) != 0) {
+                strings_fuzz_main_input[idx] = (uint8_t) STRINGS_FUZZ_MAIN_CHARACTERS[_STRINGS_FUZZ_MAIN_random() % (sizeof(STRINGS_FUZZ_MAIN_CHARACTERS) - 1)];
+            }
+        }
+        LLVMFuzzerTestOneInput(strings_fuzz_main_input, size);
+    }
+    printf("Done %lu runs\n", (unsigned long) runs);
+end:
+    return EXIT_SUCCESS;
+}
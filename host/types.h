@@ -0,0 +1,22 @@
+/*
+ * types.h
+ *
+ *  Created on: 19 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __TYPES_H__
+#define __TYPES_H__
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*** TYPES host definitions ***/
+
+typedef char char_t;
+typedef float float32_t;
+typedef double float64_t;
+
+#define UNUSED(x)   ((void) (x))
+
+#endif /* __TYPES_H__ */
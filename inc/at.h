@@ -12,6 +12,7 @@
 #include "embedded_utils_flags.h"
 #endif
 #include "error.h"
+#include "mux.h"
 #include "parser.h"
 #include "terminal.h"
 #include "types.h"
@@ -30,11 +31,13 @@ typedef enum {
     AT_ERROR_COMMANDS_LIST_NOT_FOUND,
     AT_ERROR_UNKOWN_COMMAND,
     AT_ERROR_COMMAND_EXECUTION,
+    AT_ERROR_BENCHMARK_SIZE,
     // Low level drivers errors.
     AT_ERROR_BASE_TERMINAL = ERROR_BASE_STEP,
     AT_ERROR_BASE_PARSER = (AT_ERROR_BASE_TERMINAL + TERMINAL_ERROR_BASE_LAST),
+    AT_ERROR_BASE_MUX = (AT_ERROR_BASE_PARSER + PARSER_ERROR_BASE_LAST),
     // Last base value.
-    AT_ERROR_BASE_LAST = (AT_ERROR_BASE_PARSER + PARSER_ERROR_BASE_LAST)
+    AT_ERROR_BASE_LAST = (AT_ERROR_BASE_MUX + MUX_ERROR_BASE_LAST)
 } AT_status_t;
 
 #ifndef EMBEDDED_UTILS_AT_DRIVER_DISABLE
@@ -67,9 +70,20 @@ typedef struct {
  * \brief AT driver configuration structure.
  *******************************************************************/
 typedef struct {
+#ifdef EMBEDDED_UTILS_AT_MUX
+    uint8_t mux_channel;
+#else
     uint8_t terminal_instance;
 #ifndef EMBEDDED_UTILS_AT_BAUD_RATE
     uint32_t terminal_baud_rate;
+#endif
+#ifndef EMBEDDED_UTILS_TERMINAL_BUFFER_SIZE
+    char_t* terminal_tx_buffer;
+    uint32_t terminal_tx_buffer_size;
+#endif
+#ifdef EMBEDDED_UTILS_TERMINAL_FLOW_CONTROL
+    TERMINAL_flow_control_t terminal_flow_control;
+#endif
 #endif
     AT_process_callback_t process_callback;
 } AT_configuration_t;
@@ -79,6 +93,7 @@ typedef struct {
 /*!******************************************************************
  * \fn AT_status_t AT_init(AT_configuration_t* configuration, PARSER_context_t** parser_context_ptr)
  * \brief Initialize AT command manager.
+ * \brief With EMBEDDED_UTILS_AT_MUX, the MUX driver must be initialized first and replies are queued on the configured channel.
  * \param[in]   configuration: Pointer to the AT configuration structure.
  * \param[out]  parser_context_ptr: Pointer which will be set to the internal AT parser.
  * \retval      Function execution status.
@@ -141,6 +156,20 @@ void AT_reply_add_string(char_t* str);
  *******************************************************************/
 void AT_reply_add_integer(int32_t value, STRING_format_t format, uint8_t print_prefix);
 
+/*!******************************************************************
+ * \fn void AT_reply_add_integer_array(void* data, STRING_array_type_t data_type, uint32_t data_size, STRING_format_t format, uint8_t print_prefix, char_t separator)
+ * \brief Add an integer array to the reply buffer, with a separator between values. The reply is partially sent when the buffer is full.
+ * \param[in]   data: Integer array to print.
+ * \param[in]   data_type: Type of the array elements.
+ * \param[in]   data_size: Number of elements in the array.
+ * \param[in]   format: Format of the output string.
+ * \param[in]   print_prefix: Print the base prefix of each value if non zero.
+ * \param[in]   separator: Character printed between values (STRING_CHAR_NULL for none).
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void AT_reply_add_integer_array(void* data, STRING_array_type_t data_type, uint32_t data_size, STRING_format_t format, uint8_t print_prefix, char_t separator);
+
 /*!******************************************************************
  * \fn void AT_reply_add_byte_array(uint8_t instance, uint8_t* data, uint32_t data_size_bytes, uint8_t print_prefix)
  * \brief Add a byte array to the reply buffer.
@@ -152,6 +181,16 @@ void AT_reply_add_integer(int32_t value, STRING_format_t format, uint8_t print_p
  *******************************************************************/
 void AT_reply_add_byte_array(uint8_t* data, uint32_t data_size_bytes, uint8_t print_prefix);
 
+/*!******************************************************************
+ * \fn void AT_reply_add_format(char_t* format, ...)
+ * \brief Add a formatted message to the reply buffer (see STRING_append_format() for supported specifiers).
+ * \param[in]   format: null-terminated format string.
+ * \param[in]   ...: Arguments referenced by the format string.
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void AT_reply_add_format(char_t* format, ...) __attribute__((format(printf, 1, 2)));
+
 /*!******************************************************************
  * \fn void AT_send_reply(void)
  * \brief Send the reply buffer.
@@ -0,0 +1,110 @@
+/*
+ * cobs.h
+ *
+ *  Created on: 19 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __COBS_H__
+#define __COBS_H__
+
+#ifndef EMBEDDED_UTILS_DISABLE_FLAGS_FILE
+#include "embedded_utils_flags.h"
+#endif
+#include "error.h"
+#include "types.h"
+
+/*** COBS macros ***/
+
+#define COBS_FRAME_DELIMITER            0x00
+#define COBS_BLOCK_SIZE_MAX             254
+
+/*!******************************************************************
+ * \fn COBS_FRAME_SIZE_MAX(data_size_bytes)
+ * \brief Worst case size of an encoded frame, including the delimiter.
+ *******************************************************************/
+#define COBS_FRAME_SIZE_MAX(data_size_bytes)    ((data_size_bytes) + ((data_size_bytes) / COBS_BLOCK_SIZE_MAX) + 2)
+
+/*** COBS structures ***/
+
+/*!******************************************************************
+ * \enum COBS_status_t
+ * \brief COBS driver error codes.
+ *******************************************************************/
+typedef enum {
+    // Driver errors.
+    COBS_SUCCESS = 0,
+    COBS_ERROR_NULL_PARAMETER,
+    COBS_ERROR_ENCODING_OVERFLOW,
+    COBS_ERROR_DECODING_OVERFLOW,
+    COBS_ERROR_FRAME_TRUNCATED,
+    // Last base value.
+    COBS_ERROR_BASE_LAST = ERROR_BASE_STEP
+} COBS_status_t;
+
+#ifndef EMBEDDED_UTILS_COBS_DRIVER_DISABLE
+
+/*!******************************************************************
+ * \struct COBS_decoder_t
+ * \brief COBS incremental decoder context.
+ *******************************************************************/
+typedef struct {
+    uint8_t* buffer;
+    uint32_t buffer_size_max;
+    uint32_t size;
+    uint8_t block_code;
+    uint8_t block_remaining_size;
+    uint8_t discard_flag;
+} COBS_decoder_t;
+
+/*** COBS functions ***/
+
+/*!******************************************************************
+ * \fn COBS_status_t COBS_encode(uint8_t* buffer, uint32_t buffer_size_max, uint8_t* data, uint32_t data_size_bytes, uint32_t* buffer_size)
+ * \brief Encode a data block and append the resulting frame (delimiter included) to a buffer.
+ * \brief The frame is built directly in the destination buffer, which must have COBS_FRAME_SIZE_MAX(data_size_bytes) free bytes.
+ * \param[in]   buffer: Destination buffer.
+ * \param[in]   buffer_size_max: Maximum size of the destination buffer.
+ * \param[in]   data: Bytes to encode.
+ * \param[in]   data_size_bytes: Number of bytes to encode.
+ * \param[in]   buffer_size: Pointer to the current size of the destination buffer.
+ * \param[out]  buffer_size: Pointer to the new size of the destination buffer.
+ * \retval      Function execution status.
+ *******************************************************************/
+COBS_status_t COBS_encode(uint8_t* buffer, uint32_t buffer_size_max, uint8_t* data, uint32_t data_size_bytes, uint32_t* buffer_size);
+
+/*!******************************************************************
+ * \fn COBS_status_t COBS_init_decoder(COBS_decoder_t* decoder, uint8_t* buffer, uint32_t buffer_size_max)
+ * \brief Initialize an incremental decoder.
+ * \param[in]   decoder: Pointer to the decoder context.
+ * \param[in]   buffer: Buffer receiving the decoded frame.
+ * \param[in]   buffer_size_max: Size of the frame buffer.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+COBS_status_t COBS_init_decoder(COBS_decoder_t* decoder, uint8_t* buffer, uint32_t buffer_size_max);
+
+/*!******************************************************************
+ * \fn COBS_status_t COBS_decode_byte(COBS_decoder_t* decoder, uint8_t byte, uint8_t* frame_ready)
+ * \brief Decode an incoming byte. This function is designed to be called in the terminal RX interrupt.
+ * \brief When a frame is complete, its size is available in the decoder context until the next byte is decoded.
+ * \brief After an error, the following bytes are discarded until the next delimiter.
+ * \param[in]   decoder: Pointer to the decoder context.
+ * \param[in]   byte: Received byte.
+ * \param[out]  frame_ready: Pointer that will be set to 1 if a complete frame is available in the decoder buffer, 0 otherwise.
+ * \retval      Function execution status.
+ *******************************************************************/
+COBS_status_t COBS_decode_byte(COBS_decoder_t* decoder, uint8_t byte, uint8_t* frame_ready);
+
+/*******************************************************************/
+#define COBS_exit_error(base) { ERROR_check_exit(cobs_status, COBS_SUCCESS, base) }
+
+/*******************************************************************/
+#define COBS_stack_error(base) { ERROR_check_stack(cobs_status, COBS_SUCCESS, base) }
+
+/*******************************************************************/
+#define COBS_stack_exit_error(base, code) { ERROR_check_stack_exit(cobs_status, COBS_SUCCESS, base, code) }
+
+#endif /* EMBEDDED_UTILS_COBS_DRIVER_DISABLE */
+
+#endif /* __COBS_H__ */
@@ -46,6 +46,14 @@
 #define MATH_U32_SIZE_DECIMAL_DIGITS            10
 #define MATH_U32_SIZE_HEXADECIMAL_DIGITS        8
 
+#define MATH_U64_MIN                            0
+#define MATH_U64_MAX                            18446744073709551615ULL
+#define MATH_U64_MASK                           0xFFFFFFFFFFFFFFFFULL
+#define MATH_U64_SIZE_BITS                      64
+#define MATH_U64_SIZE_BYTES                     8
+#define MATH_U64_SIZE_DECIMAL_DIGITS            20
+#define MATH_U64_SIZE_HEXADECIMAL_DIGITS        16
+
 #define MATH_S8_MIN                             (-128)
 #define MATH_S8_MAX                             127
 #define MATH_S8_MASK                            0xFF
@@ -69,6 +77,14 @@
 #define MATH_S32_SIZE_DECIMAL_DIGITS            10
 #define MATH_S32_SIZE_HEXADECIMAL_DIGITS        8
 
+#define MATH_S64_MIN                            (-9223372036854775807LL - 1)
+#define MATH_S64_MAX                            9223372036854775807LL
+#define MATH_S64_MASK                           0xFFFFFFFFFFFFFFFFULL
+#define MATH_S64_SIZE_BITS                      64
+#define MATH_S64_SIZE_BYTES                     8
+#define MATH_S64_SIZE_DECIMAL_DIGITS            19
+#define MATH_S64_SIZE_HEXADECIMAL_DIGITS        16
+
 #define MATH_BOOLEAN_DIGIT_VALUE_MAX            1
 #define MATH_DECIMAL_DIGIT_VALUE_MAX            9
 #define MATH_HEXADECIMAL_DIGIT_VALUE_MAX        15
@@ -0,0 +1,128 @@
+/*
+ * mux.h
+ *
+ *  Created on: 19 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __MUX_H__
+#define __MUX_H__
+
+#ifndef EMBEDDED_UTILS_DISABLE_FLAGS_FILE
+#include "embedded_utils_flags.h"
+#endif
+#include "cobs.h"
+#include "error.h"
+#include "terminal.h"
+#include "types.h"
+
+/*** MUX structures ***/
+
+/*!******************************************************************
+ * \enum MUX_status_t
+ * \brief MUX driver error codes.
+ *******************************************************************/
+typedef enum {
+    // Driver errors.
+    MUX_SUCCESS = 0,
+    MUX_ERROR_NULL_PARAMETER,
+    MUX_ERROR_CHANNEL,
+    MUX_ERROR_SCHEDULING,
+    MUX_ERROR_QUEUE_FULL,
+    // Low level drivers errors.
+    MUX_ERROR_BASE_TERMINAL = ERROR_BASE_STEP,
+    MUX_ERROR_BASE_COBS = (MUX_ERROR_BASE_TERMINAL + TERMINAL_ERROR_BASE_LAST),
+    // Last base value.
+    MUX_ERROR_BASE_LAST = (MUX_ERROR_BASE_COBS + COBS_ERROR_BASE_LAST)
+} MUX_status_t;
+
+#if (!(defined EMBEDDED_UTILS_MUX_DRIVER_DISABLE) && (EMBEDDED_UTILS_MUX_CHANNELS_NUMBER > 0))
+
+/*!******************************************************************
+ * \enum MUX_scheduling_t
+ * \brief MUX channels scheduling policies.
+ *******************************************************************/
+typedef enum {
+    MUX_SCHEDULING_ROUND_ROBIN = 0,
+    MUX_SCHEDULING_PRIORITY,
+    MUX_SCHEDULING_LAST
+} MUX_scheduling_t;
+
+/*!******************************************************************
+ * \struct MUX_configuration_t
+ * \brief MUX driver configuration structure.
+ *******************************************************************/
+typedef struct {
+    uint8_t terminal_instance;
+    uint32_t terminal_baud_rate;
+#ifndef EMBEDDED_UTILS_TERMINAL_BUFFER_SIZE
+    char_t* terminal_tx_buffer;
+    uint32_t terminal_tx_buffer_size;
+#endif
+    MUX_scheduling_t scheduling;
+    TERMINAL_rx_irq_cb_t rx_irq_callback[EMBEDDED_UTILS_MUX_CHANNELS_NUMBER];
+} MUX_configuration_t;
+
+/*** MUX functions ***/
+
+/*!******************************************************************
+ * \fn MUX_status_t MUX_init(MUX_configuration_t* configuration)
+ * \brief Open the physical terminal and initialize all logical channels.
+ * \brief Each frame carries the channel index followed by the payload, encoded with COBS so that the receiver can always resynchronize on the next delimiter.
+ * \param[in]   configuration: Pointer to the MUX configuration structure.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+MUX_status_t MUX_init(MUX_configuration_t* configuration);
+
+/*!******************************************************************
+ * \fn MUX_status_t MUX_de_init(void)
+ * \brief Release the multiplexer and close the physical terminal.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+MUX_status_t MUX_de_init(void);
+
+/*!******************************************************************
+ * \fn MUX_status_t MUX_write(uint8_t channel, uint8_t* data, uint32_t data_size_bytes)
+ * \brief Queue data on a logical channel.
+ * \param[in]   channel: Logical channel to use.
+ * \param[in]   data: Bytes to send.
+ * \param[in]   data_size_bytes: Number of bytes to send.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+MUX_status_t MUX_write(uint8_t channel, uint8_t* data, uint32_t data_size_bytes);
+
+/*!******************************************************************
+ * \fn MUX_status_t MUX_set_rx_irq_callback(uint8_t channel, TERMINAL_rx_irq_cb_t rx_irq_callback)
+ * \brief Set the function called for each byte received on a logical channel (for drivers attached after MUX initialization).
+ * \param[in]   channel: Logical channel to use.
+ * \param[in]   rx_irq_callback: Function to call on byte reception, NULL to drop the channel data.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+MUX_status_t MUX_set_rx_irq_callback(uint8_t channel, TERMINAL_rx_irq_cb_t rx_irq_callback);
+
+/*!******************************************************************
+ * \fn MUX_status_t MUX_process(void)
+ * \brief Send all pending data of the logical channels on the physical terminal.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+MUX_status_t MUX_process(void);
+
+/*******************************************************************/
+#define MUX_exit_error(base) { ERROR_check_exit(mux_status, MUX_SUCCESS, base) }
+
+/*******************************************************************/
+#define MUX_stack_error(base) { ERROR_check_stack(mux_status, MUX_SUCCESS, base) }
+
+/*******************************************************************/
+#define MUX_stack_exit_error(base, code) { ERROR_check_stack_exit(mux_status, MUX_SUCCESS, base, code) }
+
+#endif /* EMBEDDED_UTILS_MUX_DRIVER_DISABLE */
+
+#endif /* __MUX_H__ */
@@ -74,6 +74,27 @@ typedef struct {
  *******************************************************************/
 PARSER_status_t PARSER_compare(PARSER_context_t* parser_ctx, PARSER_mode_t mode, char_t* reference);
 
+/*!******************************************************************
+ * \fn PARSER_status_t PARSER_compare_view(PARSER_context_t* parser_ctx, PARSER_mode_t mode, STRING_view_t reference)
+ * \brief Compare a character buffer to a reference view. Size is checked before any character comparison.
+ * \param[in]   parser_ctx: Parser context.
+ * \param[in]   mode: Comparison mode.
+ * \param[in]   reference: String view reference to compare with.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+PARSER_status_t PARSER_compare_view(PARSER_context_t* parser_ctx, PARSER_mode_t mode, STRING_view_t reference);
+
+/*!******************************************************************
+ * \fn PARSER_status_t PARSER_search_view(PARSER_context_t* parser_ctx, STRING_view_t reference)
+ * \brief Search a reference view anywhere after the current position and move the start index after it.
+ * \param[in]   parser_ctx: Parser context.
+ * \param[in]   reference: String view reference to search.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+PARSER_status_t PARSER_search_view(PARSER_context_t* parser_ctx, STRING_view_t reference);
+
 /*!******************************************************************
  * \fn PARSER_status_t PARSER_get_parameter(PARSER_context_t* parser_ctx, STRING_format_t format, char_t separator, int32_t* parameter
  * \brief Parse a parameter within a character buffer.
@@ -85,6 +106,27 @@ PARSER_status_t PARSER_compare(PARSER_context_t* parser_ctx, PARSER_mode_t mode,
  *******************************************************************/
 PARSER_status_t PARSER_get_parameter(PARSER_context_t* parser_ctx, STRING_format_t format, char_t separator, int32_t* parameter);
 
+/*!******************************************************************
+ * \fn PARSER_status_t PARSER_get_integer(PARSER_context_t* parser_ctx, char_t separator, int32_t* parameter)
+ * \brief Parse an integer parameter within a character buffer in a single pass, with automatic format detection (0x, 0b or 0d prefix).
+ * \param[in]   parser_ctx: Parser context.
+ * \param[in]   separator: Parameter separator (STRING_CHAR_NULL if the parameter ends the buffer).
+ * \param[out]  parameter: Pointer to the parameter value.
+ * \retval      Function execution status.
+ *******************************************************************/
+PARSER_status_t PARSER_get_integer(PARSER_context_t* parser_ctx, char_t separator, int32_t* parameter);
+
+/*!******************************************************************
+ * \fn PARSER_status_t PARSER_get_floating_decimal_parameter(PARSER_context_t* parser_ctx, char_t separator, uint8_t multiplier_exponent, int32_t* parameter)
+ * \brief Parse a decimal parameter with optional fraction and exponent within a character buffer, as an integer scaled by 10^(multiplier_exponent).
+ * \param[in]   parser_ctx: Parser context.
+ * \param[in]   separator: Parameter separator.
+ * \param[in]   multiplier_exponent: Parameter will be multiplied by 10^(multiplier_exponent) and rounded to the nearest integer.
+ * \param[out]  parameter: Pointer to the scaled parameter value.
+ * \retval      Function execution status.
+ *******************************************************************/
+PARSER_status_t PARSER_get_floating_decimal_parameter(PARSER_context_t* parser_ctx, char_t separator, uint8_t multiplier_exponent, int32_t* parameter);
+
 /*!******************************************************************
  * \fn PARSER_status_t PARSER_get_byte_array(PARSER_context_t* parser_ctx, char_t separator, uint32_t maximum_size, uint8_t exact_size, uint8_t* parameter, uint32_t* extracted_size)
  * \brief Parse a byte array within a character buffer.
@@ -98,6 +140,18 @@ PARSER_status_t PARSER_get_parameter(PARSER_context_t* parser_ctx, STRING_format
  *******************************************************************/
 PARSER_status_t PARSER_get_byte_array(PARSER_context_t* parser_ctx, char_t separator, uint32_t maximum_size, uint8_t exact_size, uint8_t* parameter, uint32_t* extracted_size);
 
+/*!******************************************************************
+ * \fn PARSER_status_t PARSER_get_base64(PARSER_context_t* parser_ctx, char_t separator, uint32_t maximum_size, uint8_t* parameter, uint32_t* extracted_size)
+ * \brief Parse a Base64 encoded byte array within a character buffer.
+ * \param[in]   parser_ctx: Parser context.
+ * \param[in]   separator: Parameter separator.
+ * \param[in]   maximum_size: Maximum size of the byte array to parse.
+ * \param[out]  parameter: Pointer to the parameter value.
+ * \param[out]  extracted_size: Pointer to the effective size of the parsed parameter.
+ * \retval      Function execution status.
+ *******************************************************************/
+PARSER_status_t PARSER_get_base64(PARSER_context_t* parser_ctx, char_t separator, uint32_t maximum_size, uint8_t* parameter, uint32_t* extracted_size);
+
 /*******************************************************************/
 #define PARSER_exit_error(base) { ERROR_check_exit(parser_status, PARSER_SUCCESS, base) }
 
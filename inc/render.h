@@ -0,0 +1,127 @@
+/*
+ * render.h
+ *
+ *  Created on: 19 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __RENDER_H__
+#define __RENDER_H__
+
+#ifndef EMBEDDED_UTILS_DISABLE_FLAGS_FILE
+#include "embedded_utils_flags.h"
+#endif
+#include "error.h"
+#include "strings.h"
+#include "types.h"
+
+/*** RENDER macros ***/
+
+/*!******************************************************************
+ * \fn RENDER_BUFFER_SIZE(number_of_lines, line_size)
+ * \brief Size of the buffer required by a renderer (working frame and shadow of the displayed content).
+ *******************************************************************/
+#define RENDER_BUFFER_SIZE(number_of_lines, line_size)  (2 * (number_of_lines) * (line_size))
+
+/*** RENDER structures ***/
+
+/*!******************************************************************
+ * \enum RENDER_status_t
+ * \brief RENDER driver error codes.
+ *******************************************************************/
+typedef enum {
+    // Driver errors.
+    RENDER_SUCCESS = 0,
+    RENDER_ERROR_NULL_PARAMETER,
+    RENDER_ERROR_FRAME_SIZE,
+    RENDER_ERROR_LINE_INDEX,
+    RENDER_ERROR_COLUMN,
+    // Low level drivers errors.
+    RENDER_ERROR_BASE_STRING = ERROR_BASE_STEP,
+    // Last base value.
+    RENDER_ERROR_BASE_LAST = (RENDER_ERROR_BASE_STRING + STRING_ERROR_BASE_LAST)
+} RENDER_status_t;
+
+#ifndef EMBEDDED_UTILS_RENDER_DRIVER_DISABLE
+
+/*!******************************************************************
+ * \fn RENDER_write_span_cb_t
+ * \brief Display driver callback writing consecutive characters of a line.
+ *******************************************************************/
+typedef void (*RENDER_write_span_cb_t)(uint8_t line_index, uint8_t column, char_t* span, uint8_t span_size);
+
+/*!******************************************************************
+ * \struct RENDER_context_t
+ * \brief Character display renderer context.
+ *******************************************************************/
+typedef struct {
+    char_t* buffer;
+    uint8_t number_of_lines;
+    uint8_t line_size;
+    uint8_t span_gap_max;
+    uint8_t redraw_flag;
+    char_t flush_char;
+    RENDER_write_span_cb_t write_span_callback;
+} RENDER_context_t;
+
+/*** RENDER functions ***/
+
+/*!******************************************************************
+ * \fn RENDER_status_t RENDER_init(RENDER_context_t* render_ctx, char_t* buffer, uint8_t number_of_lines, uint8_t line_size, char_t flush_char, uint8_t span_gap_max, RENDER_write_span_cb_t write_span_callback)
+ * \brief Initialize a character display renderer. The whole display is written on the first refresh.
+ * \param[in]   render_ctx: Pointer to the renderer context.
+ * \param[in]   buffer: Buffer of RENDER_BUFFER_SIZE(number_of_lines, line_size) characters.
+ * \param[in]   number_of_lines: Number of lines of the display.
+ * \param[in]   line_size: Number of characters per line.
+ * \param[in]   flush_char: Character used to clear the display and to pad the fields.
+ * \param[in]   span_gap_max: Maximum number of unchanged characters included in a span to avoid starting a new one.
+ * \param[in]   write_span_callback: Function called to write the changed characters on the display.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+RENDER_status_t RENDER_init(RENDER_context_t* render_ctx, char_t* buffer, uint8_t number_of_lines, uint8_t line_size, char_t flush_char, uint8_t span_gap_max, RENDER_write_span_cb_t write_span_callback);
+
+/*!******************************************************************
+ * \fn RENDER_status_t RENDER_print(RENDER_context_t* render_ctx, uint8_t line_index, uint8_t column, uint8_t width, char_t* str, STRING_justification_t justification)
+ * \brief Print a string in a field of the working frame. The display is only updated by the RENDER_refresh() function.
+ * \param[in]   render_ctx: Pointer to the renderer context.
+ * \param[in]   line_index: Line of the field.
+ * \param[in]   column: First column of the field.
+ * \param[in]   width: Number of characters of the field.
+ * \param[in]   str: null-terminated string to print.
+ * \param[in]   justification: Justification of the string within the field.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+RENDER_status_t RENDER_print(RENDER_context_t* render_ctx, uint8_t line_index, uint8_t column, uint8_t width, char_t* str, STRING_justification_t justification);
+
+/*!******************************************************************
+ * \fn RENDER_status_t RENDER_refresh(RENDER_context_t* render_ctx)
+ * \brief Compare the working frame to the displayed content and write the changed spans only.
+ * \param[in]   render_ctx: Pointer to the renderer context.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+RENDER_status_t RENDER_refresh(RENDER_context_t* render_ctx);
+
+/*!******************************************************************
+ * \fn RENDER_status_t RENDER_invalidate(RENDER_context_t* render_ctx)
+ * \brief Force the whole display to be written on the next refresh (for example after a display reset).
+ * \param[in]   render_ctx: Pointer to the renderer context.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+RENDER_status_t RENDER_invalidate(RENDER_context_t* render_ctx);
+
+/*******************************************************************/
+#define RENDER_exit_error(base) { ERROR_check_exit(render_status, RENDER_SUCCESS, base) }
+
+/*******************************************************************/
+#define RENDER_stack_error(base) { ERROR_check_stack(render_status, RENDER_SUCCESS, base) }
+
+/*******************************************************************/
+#define RENDER_stack_exit_error(base, code) { ERROR_check_stack_exit(render_status, RENDER_SUCCESS, base, code) }
+
+#endif /* EMBEDDED_UTILS_RENDER_DRIVER_DISABLE */
+
+#endif /* __RENDER_H__ */
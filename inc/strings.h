@@ -13,6 +13,7 @@
 #endif
 #include "error.h"
 #include "types.h"
+#include <stdarg.h>
 
 /*** STRING macros ***/
 
@@ -25,6 +26,31 @@
 #define STRING_CHAR_COMMA   ','
 #define STRING_CHAR_SPACE   ' '
 
+/*!******************************************************************
+ * \fn STRING_BASE64_SIZE(data_size_bytes)
+ * \brief Size of the padded Base64 representation of a byte array.
+ *******************************************************************/
+#define STRING_BASE64_SIZE(data_size_bytes)         ((((data_size_bytes) + 2) / 3) * 4)
+
+/*!******************************************************************
+ * \fn STRING_BASE64_SIZE_FLOOR(data_size_bytes)
+ * \brief Number of Base64 characters produced by the complete triplets of a byte array.
+ *******************************************************************/
+#define STRING_BASE64_SIZE_FLOOR(data_size_bytes)   (((data_size_bytes) / 3) * 4)
+
+#if (EMBEDDED_UTILS_MATH_PRECISION > 0)
+#define STRING_FLOATING_DECIMALS_SHORTEST   0xFF
+#define STRING_FLOATING_DECIMALS_MAX        20
+// Longest floating representation: sign, 21 integer digits, decimal point and decimals.
+#define STRING_FLOATING_SIZE_MAX            (1 + 21 + 1 + STRING_FLOATING_DECIMALS_MAX)
+#endif
+
+/*!******************************************************************
+ * \fn STRING_VIEW(literal)
+ * \brief Build the view of a string literal, size is computed at compile time.
+ *******************************************************************/
+#define STRING_VIEW(literal)    ((STRING_view_t) { .str = (char_t*) (literal), .size = (sizeof(literal) - 1) })
+
 /*** STRING structures ***/
 
 /*!******************************************************************
@@ -49,6 +75,11 @@ typedef enum {
     STRING_ERROR_COPY_OVERFLOW,
     STRING_ERROR_APPEND_OVERFLOW,
     STRING_ERROR_TEXT_JUSTIFICATION,
+    STRING_ERROR_BASE64_INVALID,
+    STRING_ERROR_BASE64_SIZE,
+    STRING_ERROR_BASE64_OVERFLOW,
+    STRING_ERROR_ARRAY_TYPE,
+    STRING_ERROR_SEARCH_NOT_FOUND,
     // Last base value.
     STRING_ERROR_BASE_LAST = ERROR_BASE_STEP
 } STRING_status_t;
@@ -77,6 +108,17 @@ typedef enum {
     STRING_JUSTIFICATION_LAST
 } STRING_justification_t;
 
+/*!******************************************************************
+ * \enum STRING_array_type_t
+ * \brief Integer array element types.
+ *******************************************************************/
+typedef enum {
+    STRING_ARRAY_TYPE_INT32 = 0,
+    STRING_ARRAY_TYPE_INT16,
+    STRING_ARRAY_TYPE_UINT16,
+    STRING_ARRAY_TYPE_LAST
+} STRING_array_type_t;
+
 /*!******************************************************************
  * \struct STRING_copy_t
  * \brief String copy operation parameters.
@@ -90,6 +132,34 @@ typedef struct {
     char_t flush_char;
 } STRING_copy_t;
 
+/*!******************************************************************
+ * \struct STRING_view_t
+ * \brief String with known size (null character is not required).
+ *******************************************************************/
+typedef struct {
+    char_t* str;
+    uint32_t size;
+} STRING_view_t;
+
+/*!******************************************************************
+ * \struct STRING_base64_encoder_t
+ * \brief Base64 streaming encoder context.
+ *******************************************************************/
+typedef struct {
+    uint8_t bytes[2];
+    uint8_t number_of_bytes;
+} STRING_base64_encoder_t;
+
+/*!******************************************************************
+ * \struct STRING_base64_decoder_t
+ * \brief Base64 streaming decoder context.
+ *******************************************************************/
+typedef struct {
+    uint32_t bits;
+    uint8_t number_of_chars;
+    uint8_t padding_size;
+} STRING_base64_decoder_t;
+
 /*** STRING functions ***/
 
 /*!******************************************************************
@@ -103,6 +173,39 @@ typedef struct {
  *******************************************************************/
 STRING_status_t STRING_integer_to_string(int32_t value, STRING_format_t format, uint8_t print_prefix, char_t* str);
 
+/*!******************************************************************
+ * \fn STRING_status_t STRING_uint32_to_string(uint32_t value, STRING_format_t format, uint8_t print_prefix, char_t* str)
+ * \brief Convert an unsigned 32-bits integer to the corresponding string representation.
+ * \param[in]   value: Integer to convert.
+ * \param[in]   format: Format of the output string.
+ * \param[in]   print_prefix: Print the base prefix if non zero.
+ * \param[out]  str: Pointer to the destination string.
+ * \retval      Function execution status.
+ *******************************************************************/
+STRING_status_t STRING_uint32_to_string(uint32_t value, STRING_format_t format, uint8_t print_prefix, char_t* str);
+
+/*!******************************************************************
+ * \fn STRING_status_t STRING_int64_to_string(int64_t value, STRING_format_t format, uint8_t print_prefix, char_t* str)
+ * \brief Convert a signed 64-bits integer to the corresponding string representation.
+ * \param[in]   value: Integer to convert.
+ * \param[in]   format: Format of the output string.
+ * \param[in]   print_prefix: Print the base prefix if non zero.
+ * \param[out]  str: Pointer to the destination string.
+ * \retval      Function execution status.
+ *******************************************************************/
+STRING_status_t STRING_int64_to_string(int64_t value, STRING_format_t format, uint8_t print_prefix, char_t* str);
+
+/*!******************************************************************
+ * \fn STRING_status_t STRING_uint64_to_string(uint64_t value, STRING_format_t format, uint8_t print_prefix, char_t* str)
+ * \brief Convert an unsigned 64-bits integer to the corresponding string representation.
+ * \param[in]   value: Integer to convert.
+ * \param[in]   format: Format of the output string.
+ * \param[in]   print_prefix: Print the base prefix if non zero.
+ * \param[out]  str: Pointer to the destination string.
+ * \retval      Function execution status.
+ *******************************************************************/
+STRING_status_t STRING_uint64_to_string(uint64_t value, STRING_format_t format, uint8_t print_prefix, char_t* str);
+
 /*!******************************************************************
  * \fn STRING_status_t STRING_integer_to_floating_decimal_string(int32_t value, uint8_t divider_exponent, uint8_t number_of_digits, char_t* str)
  * \brief Convert an integer to the corresponding string representation in floating point format.
@@ -114,6 +217,34 @@ STRING_status_t STRING_integer_to_string(int32_t value, STRING_format_t format,
  *******************************************************************/
 STRING_status_t STRING_integer_to_floating_decimal_string(int32_t value, uint8_t divider_exponent, uint8_t number_of_digits, char_t* str);
 
+#if (EMBEDDED_UTILS_MATH_PRECISION > 0)
+/*!******************************************************************
+ * \fn STRING_status_t STRING_float32_to_string(float32_t value, uint8_t number_of_decimals, char_t* str)
+ * \brief Convert a float to the corresponding decimal string representation.
+ * \brief With STRING_FLOATING_DECIMALS_SHORTEST, a short string which reads back to the same value is printed (scientific notation is used for very small or large values).
+ * \brief Digits are generated with Grisu2 without exact fallback, so that a few values get one more digit than the shortest representation (for example 2.6620479441488157e-290 instead of 2.662047944148816e-290).
+ * \brief Otherwise, the exact value is rounded to the nearest with the given number of decimals, ties to even (absolute value must be lower than 10^21).
+ * \param[in]   value: Float to convert.
+ * \param[in]   number_of_decimals: Number of decimals to print or STRING_FLOATING_DECIMALS_SHORTEST.
+ * \param[out]  str: Pointer to the destination string (at least STRING_FLOATING_SIZE_MAX + 1 characters).
+ * \retval      Function execution status.
+ *******************************************************************/
+STRING_status_t STRING_float32_to_string(float32_t value, uint8_t number_of_decimals, char_t* str);
+#endif
+
+#if (EMBEDDED_UTILS_MATH_PRECISION == 2)
+/*!******************************************************************
+ * \fn STRING_status_t STRING_float64_to_string(float64_t value, uint8_t number_of_decimals, char_t* str)
+ * \brief Convert a double to the corresponding decimal string representation.
+ * \brief Output format is the same as the STRING_float32_to_string() function.
+ * \param[in]   value: Double to convert.
+ * \param[in]   number_of_decimals: Number of decimals to print or STRING_FLOATING_DECIMALS_SHORTEST.
+ * \param[out]  str: Pointer to the destination string (at least STRING_FLOATING_SIZE_MAX + 1 characters).
+ * \retval      Function execution status.
+ *******************************************************************/
+STRING_status_t STRING_float64_to_string(float64_t value, uint8_t number_of_decimals, char_t* str);
+#endif
+
 /*!******************************************************************
  * \fn STRING_status_t STRING_string_to_integer(char_t* str, STRING_format_t format, uint8_t number_of_digits, int32_t* value)
  * \brief Convert a string to the corresponding value.
@@ -125,6 +256,63 @@ STRING_status_t STRING_integer_to_floating_decimal_string(int32_t value, uint8_t
  *******************************************************************/
 STRING_status_t STRING_string_to_integer(char_t* str, STRING_format_t format, uint8_t number_of_digits, int32_t* value);
 
+/*!******************************************************************
+ * \fn STRING_status_t STRING_string_to_uint32(char_t* str, STRING_format_t format, uint8_t number_of_digits, uint32_t* value)
+ * \brief Convert a string to the corresponding unsigned 32-bits value.
+ * \param[in]   str: String to convert.
+ * \param[in]   format: Format of the input string.
+ * \param[in]   number_of_digits: Number of digits of the output value.
+ * \param[out]  value: Pointer to the destination value.
+ * \retval      Function execution status.
+ *******************************************************************/
+STRING_status_t STRING_string_to_uint32(char_t* str, STRING_format_t format, uint8_t number_of_digits, uint32_t* value);
+
+/*!******************************************************************
+ * \fn STRING_status_t STRING_string_to_int64(char_t* str, STRING_format_t format, uint8_t number_of_digits, int64_t* value)
+ * \brief Convert a string to the corresponding signed 64-bits value.
+ * \param[in]   str: String to convert.
+ * \param[in]   format: Format of the input string.
+ * \param[in]   number_of_digits: Number of digits of the output value.
+ * \param[out]  value: Pointer to the destination value.
+ * \retval      Function execution status.
+ *******************************************************************/
+STRING_status_t STRING_string_to_int64(char_t* str, STRING_format_t format, uint8_t number_of_digits, int64_t* value);
+
+/*!******************************************************************
+ * \fn STRING_status_t STRING_string_to_uint64(char_t* str, STRING_format_t format, uint8_t number_of_digits, uint64_t* value)
+ * \brief Convert a string to the corresponding unsigned 64-bits value.
+ * \param[in]   str: String to convert.
+ * \param[in]   format: Format of the input string.
+ * \param[in]   number_of_digits: Number of digits of the output value.
+ * \param[out]  value: Pointer to the destination value.
+ * \retval      Function execution status.
+ *******************************************************************/
+STRING_status_t STRING_string_to_uint64(char_t* str, STRING_format_t format, uint8_t number_of_digits, uint64_t* value);
+
+/*!******************************************************************
+ * \fn STRING_status_t STRING_parse_integer(char_t* str, uint32_t str_size_max, int32_t* value, uint32_t* parsed_size)
+ * \brief Convert the integer at the beginning of a string, stopping at the first character which is not a digit.
+ * \brief The format is detected from the optional 0x (hexadecimal), 0b (binary) or 0d (decimal) prefix, decimal is used by default.
+ * \param[in]   str: String to convert.
+ * \param[in]   str_size_max: Maximum number of characters to read.
+ * \param[out]  value: Pointer to the destination value.
+ * \param[out]  parsed_size: Pointer to the number of characters consumed (sign and prefix included).
+ * \retval      Function execution status.
+ *******************************************************************/
+STRING_status_t STRING_parse_integer(char_t* str, uint32_t str_size_max, int32_t* value, uint32_t* parsed_size);
+
+/*!******************************************************************
+ * \fn STRING_status_t STRING_floating_decimal_string_to_integer(char_t* str, uint32_t str_size, uint8_t multiplier_exponent, int32_t* value)
+ * \brief Convert a decimal string with optional fraction and exponent (for example "-0.005" or "3.14e2") to a scaled integer.
+ * \brief The result is rounded half away from zero, without floating point arithmetic.
+ * \param[in]   str: String to convert.
+ * \param[in]   str_size: Number of characters to convert.
+ * \param[in]   multiplier_exponent: Input value will be multiplied by 10^(multiplier_exponent) before being stored.
+ * \param[out]  value: Pointer to the destination value.
+ * \retval      Function execution status.
+ *******************************************************************/
+STRING_status_t STRING_floating_decimal_string_to_integer(char_t* str, uint32_t str_size, uint8_t multiplier_exponent, int32_t* value);
+
 /*!******************************************************************
  * \fn STRING_status_t STRING_byte_array_to_hexadecimal_string(uint8_t* data, uint32_t data_size_bytes, uint8_t print_prefix, char_t* str)
  * \brief Convert a byte array to the corresponding string representation.
@@ -147,15 +335,138 @@ STRING_status_t STRING_byte_array_to_hexadecimal_string(uint8_t* data, uint32_t
  *******************************************************************/
 STRING_status_t STRING_hexadecimal_string_to_byte_array(char_t* str, char_t end_character, uint8_t* data, uint32_t* extracted_size);
 
+/*!******************************************************************
+ * \fn STRING_status_t STRING_base64_init_encoder(STRING_base64_encoder_t* encoder)
+ * \brief Initialize a Base64 streaming encoder.
+ * \param[in]   encoder: Pointer to the encoder context.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+STRING_status_t STRING_base64_init_encoder(STRING_base64_encoder_t* encoder);
+
+/*!******************************************************************
+ * \fn STRING_status_t STRING_base64_encode(STRING_base64_encoder_t* encoder, uint8_t* data, uint32_t data_size_bytes, char_t* str, uint32_t str_size_max, uint32_t* str_size)
+ * \brief Encode a chunk of data in Base64 and append the characters of all complete triplets to a string.
+ * \brief Up to 2 remaining bytes are kept in the encoder context until the next chunk or the final call.
+ * \param[in]   encoder: Pointer to the encoder context.
+ * \param[in]   data: Bytes to encode.
+ * \param[in]   data_size_bytes: Number of bytes to encode.
+ * \param[in]   str: Destination string.
+ * \param[in]   str_size_max: Maximum size of the destination string.
+ * \param[out]  str_size: Pointer to the new size of the destination string.
+ * \retval      Function execution status.
+ *******************************************************************/
+STRING_status_t STRING_base64_encode(STRING_base64_encoder_t* encoder, uint8_t* data, uint32_t data_size_bytes, char_t* str, uint32_t str_size_max, uint32_t* str_size);
+
+/*!******************************************************************
+ * \fn STRING_status_t STRING_base64_encode_final(STRING_base64_encoder_t* encoder, char_t* str, uint32_t str_size_max, uint32_t* str_size)
+ * \brief Append the remaining bytes of a Base64 stream with padding.
+ * \param[in]   encoder: Pointer to the encoder context.
+ * \param[in]   str: Destination string.
+ * \param[in]   str_size_max: Maximum size of the destination string.
+ * \param[out]  str_size: Pointer to the new size of the destination string.
+ * \retval      Function execution status.
+ *******************************************************************/
+STRING_status_t STRING_base64_encode_final(STRING_base64_encoder_t* encoder, char_t* str, uint32_t str_size_max, uint32_t* str_size);
+
+/*!******************************************************************
+ * \fn STRING_status_t STRING_base64_init_decoder(STRING_base64_decoder_t* decoder)
+ * \brief Initialize a Base64 streaming decoder.
+ * \param[in]   decoder: Pointer to the decoder context.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+STRING_status_t STRING_base64_init_decoder(STRING_base64_decoder_t* decoder);
+
+/*!******************************************************************
+ * \fn STRING_status_t STRING_base64_decode(STRING_base64_decoder_t* decoder, char_t* str, uint32_t str_size, uint8_t* data, uint32_t data_size_max, uint32_t* data_size)
+ * \brief Decode a chunk of Base64 characters and append the resulting bytes to a buffer.
+ * \brief Chunks can be split anywhere. The decoder must be initialized again after an error.
+ * \param[in]   decoder: Pointer to the decoder context.
+ * \param[in]   str: Characters to decode.
+ * \param[in]   str_size: Number of characters to decode.
+ * \param[in]   data: Destination buffer.
+ * \param[in]   data_size_max: Maximum size of the destination buffer.
+ * \param[out]  data_size: Pointer to the new size of the destination buffer.
+ * \retval      Function execution status.
+ *******************************************************************/
+STRING_status_t STRING_base64_decode(STRING_base64_decoder_t* decoder, char_t* str, uint32_t str_size, uint8_t* data, uint32_t data_size_max, uint32_t* data_size);
+
+/*!******************************************************************
+ * \fn STRING_status_t STRING_base64_decode_final(STRING_base64_decoder_t* decoder, uint8_t* data, uint32_t data_size_max, uint32_t* data_size)
+ * \brief End a Base64 stream. Unpadded input is accepted.
+ * \param[in]   decoder: Pointer to the decoder context.
+ * \param[in]   data: Destination buffer.
+ * \param[in]   data_size_max: Maximum size of the destination buffer.
+ * \param[out]  data_size: Pointer to the new size of the destination buffer.
+ * \retval      Function execution status.
+ *******************************************************************/
+STRING_status_t STRING_base64_decode_final(STRING_base64_decoder_t* decoder, uint8_t* data, uint32_t data_size_max, uint32_t* data_size);
+
 /*!******************************************************************
  * \fn STRING_status_t STRING_get_size(char_t* str, uint32_t* size)
  * \brief Get the size of a NULL terminated string.
+ * \brief The string is scanned word by word, so that the aligned word containing the null character is entirely read.
  * \param[in]   str: String to read.
  * \param[out]  size: Pointer to the string size.
  * \retval      Function execution status.
  *******************************************************************/
 STRING_status_t STRING_get_size(char_t* str, uint32_t* size);
 
+/*!******************************************************************
+ * \fn STRING_status_t STRING_get_bounded_size(char_t* str, uint32_t str_size_max, uint32_t* size)
+ * \brief Get the size of a NULL terminated string stored in a buffer of known size.
+ * \brief The string is scanned word by word and no character is read beyond the buffer.
+ * \param[in]   str: String to read.
+ * \param[in]   str_size_max: Size of the buffer containing the string (null character included).
+ * \param[out]  size: Pointer to the string size.
+ * \retval      Function execution status.
+ *******************************************************************/
+STRING_status_t STRING_get_bounded_size(char_t* str, uint32_t str_size_max, uint32_t* size);
+
+/*!******************************************************************
+ * \fn STRING_status_t STRING_get_view(char_t* str, STRING_view_t* view)
+ * \brief Build the view of a NULL terminated string.
+ * \param[in]   str: String to read.
+ * \param[out]  view: Pointer to the string view.
+ * \retval      Function execution status.
+ *******************************************************************/
+STRING_status_t STRING_get_view(char_t* str, STRING_view_t* view);
+
+/*!******************************************************************
+ * \fn STRING_status_t STRING_search_char(char_t* str, uint32_t str_size, char_t chr, uint32_t* index)
+ * \brief Search the first occurence of a character in a buffer.
+ * \brief The buffer is scanned word by word and no character is read beyond its size.
+ * \param[in]   str: Buffer to search in.
+ * \param[in]   str_size: Number of characters of the buffer.
+ * \param[in]   chr: Character to search.
+ * \param[out]  index: Pointer to the index of the character in the buffer.
+ * \retval      Function execution status.
+ *******************************************************************/
+STRING_status_t STRING_search_char(char_t* str, uint32_t str_size, char_t chr, uint32_t* index);
+
+/*!******************************************************************
+ * \fn STRING_status_t STRING_search_any(char_t* str, uint32_t str_size, char_t* set, uint32_t* index)
+ * \brief Search the first occurence of any character of a set in a buffer.
+ * \param[in]   str: Buffer to search in.
+ * \param[in]   str_size: Number of characters of the buffer.
+ * \param[in]   set: NULL terminated string containing the characters to search.
+ * \param[out]  index: Pointer to the index of the character in the buffer.
+ * \retval      Function execution status.
+ *******************************************************************/
+STRING_status_t STRING_search_any(char_t* str, uint32_t str_size, char_t* set, uint32_t* index);
+
+/*!******************************************************************
+ * \fn STRING_status_t STRING_search_view(char_t* str, uint32_t str_size, STRING_view_t pattern, uint32_t* index)
+ * \brief Search the first occurence of a pattern in a buffer (Two-Way algorithm, linear time and constant memory).
+ * \param[in]   str: Buffer to search in.
+ * \param[in]   str_size: Number of characters of the buffer.
+ * \param[in]   pattern: String view of the pattern to search.
+ * \param[out]  index: Pointer to the index of the pattern in the buffer.
+ * \retval      Function execution status.
+ *******************************************************************/
+STRING_status_t STRING_search_view(char_t* str, uint32_t str_size, STRING_view_t pattern, uint32_t* index);
+
 /*!******************************************************************
  * \fn STRING_status_t STRING_copy(STRING_copy_t* copy)
  * \brief Copy a string into another one.
@@ -165,6 +476,16 @@ STRING_status_t STRING_get_size(char_t* str, uint32_t* size);
  *******************************************************************/
 STRING_status_t STRING_copy(STRING_copy_t* copy);
 
+/*!******************************************************************
+ * \fn STRING_status_t STRING_copy_view(STRING_copy_t* copy, STRING_view_t source)
+ * \brief Copy a string view into another one (source field of the copy parameters is not used).
+ * \param[in]   copy: Pointer to the copy operation parameters.
+ * \param[in]   source: Source string view.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+STRING_status_t STRING_copy_view(STRING_copy_t* copy, STRING_view_t source);
+
 /*!******************************************************************
  * \fn STRING_status_t STRING_append_string(char_t* str, uint32_t str_size_max, char_t* new_str, uint32_t* str_size)
  * \brief Append a string to another one.
@@ -176,6 +497,17 @@ STRING_status_t STRING_copy(STRING_copy_t* copy);
  *******************************************************************/
 STRING_status_t STRING_append_string(char_t* str, uint32_t str_size_max, char_t* new_str, uint32_t* str_size);
 
+/*!******************************************************************
+ * \fn STRING_status_t STRING_append_view(char_t* str, uint32_t str_size_max, STRING_view_t view, uint32_t* str_size)
+ * \brief Append a string view to another string.
+ * \param[in]   str: Destination string.
+ * \param[in]   str_size_max: Maximum size of the destination string.
+ * \param[in]   view: String view to append.
+ * \param[out]  str_size: Pointer to the new size of the destination string.
+ * \retval      Function execution status.
+ *******************************************************************/
+STRING_status_t STRING_append_view(char_t* str, uint32_t str_size_max, STRING_view_t view, uint32_t* str_size);
+
 /*!******************************************************************
  * \fn STRING_status_t STRING_append_integer(char_t* str, uint32_t str_size_max, int32_t value, STRING_format_t format, uint8_t print_prefix, uint32_t* str_size)
  * \brief Convert an integer to its string representation and append it to another string.
@@ -189,9 +521,41 @@ STRING_status_t STRING_append_string(char_t* str, uint32_t str_size_max, char_t*
  *******************************************************************/
 STRING_status_t STRING_append_integer(char_t* str, uint32_t str_size_max, int32_t value, STRING_format_t format, uint8_t print_prefix, uint32_t* str_size);
 
+/*!******************************************************************
+ * \fn STRING_status_t STRING_append_fixed_point(char_t* str, uint32_t str_size_max, int32_t value, uint8_t number_of_decimals, uint32_t* str_size)
+ * \brief Convert a fixed point integer to its decimal representation and append it to another string (2350 with 2 decimals is printed as 23.50).
+ * \param[in]   str: Destination string.
+ * \param[in]   str_size_max: Maximum size of the destination string.
+ * \param[in]   value: Fixed point value to convert and append.
+ * \param[in]   number_of_decimals: Number of decimals of the value, up to 9.
+ * \param[out]  str_size: Pointer to the new size of the destination string.
+ * \retval      Function execution status.
+ *******************************************************************/
+STRING_status_t STRING_append_fixed_point(char_t* str, uint32_t str_size_max, int32_t value, uint8_t number_of_decimals, uint32_t* str_size);
+
+/*!******************************************************************
+ * \fn STRING_status_t STRING_append_integer_array(char_t* str, uint32_t str_size_max, void* data, STRING_array_type_t data_type, uint32_t data_size, STRING_format_t format, uint8_t print_prefix, char_t separator, uint32_t* str_size, uint32_t* data_index)
+ * \brief Convert an integer array to its string representation and append it to another string, with a separator between values.
+ * \brief Each value is appended with its separator or not at all, so that the conversion can be resumed from data_index after an overflow.
+ * \param[in]   str: Destination string.
+ * \param[in]   str_size_max: Maximum size of the destination string.
+ * \param[in]   data: Integer array to convert.
+ * \param[in]   data_type: Type of the array elements.
+ * \param[in]   data_size: Number of elements in the array.
+ * \param[in]   format: Format of the output string.
+ * \param[in]   print_prefix: Print the base prefix of each value if non zero.
+ * \param[in]   separator: Character printed between values (STRING_CHAR_NULL for none).
+ * \param[in]   data_index: Pointer to the index of the first value to append.
+ * \param[out]  str_size: Pointer to the new size of the destination string.
+ * \param[out]  data_index: Pointer to the index of the first value which has not been appended.
+ * \retval      Function execution status.
+ *******************************************************************/
+STRING_status_t STRING_append_integer_array(char_t* str, uint32_t str_size_max, void* data, STRING_array_type_t data_type, uint32_t data_size, STRING_format_t format, uint8_t print_prefix, char_t separator, uint32_t* str_size, uint32_t* data_index);
+
 /*!******************************************************************
  * \fn STRING_status_t STRING_append_byte_array(char_t* str, uint32_t str_size_max, uint8_t* data, uint32_t data_size_bytes, uint8_t print_prefix, uint32_t* str_size)
  * \brief Convert a byte array to its hexadecimal string representation and append it to another string.
+ * \brief Nothing is appended if the destination string is too small for the whole array.
  * \param[in]   str: Destination string.
  * \param[in]   str_size_max: Maximum size of the destination string.
  * \param[in]   data: Byte array to append.
@@ -202,6 +566,35 @@ STRING_status_t STRING_append_integer(char_t* str, uint32_t str_size_max, int32_
  *******************************************************************/
 STRING_status_t STRING_append_byte_array(char_t* str, uint32_t str_size_max, uint8_t* data, uint32_t data_size_bytes, uint8_t print_prefix, uint32_t* str_size);
 
+/*!******************************************************************
+ * \fn STRING_status_t STRING_append_format(char_t* str, uint32_t str_size_max, uint32_t* str_size, char_t* format, ...)
+ * \brief Append a printf-style formatted string to another string, without intermediate buffer.
+ * \brief Supported specifiers are %d %i %u %x %X %c %s and %%, with optional '-' and '0' flags, field width, precision and 'l' length modifier.
+ * \brief The grammar is a subset of printf, so that the compiler format check is enabled. Field width and precision are limited to 255, and integers precision to 10.
+ * \brief Fixed point values are printed with STRING_append_fixed_point().
+ * \param[in]   str: Destination string.
+ * \param[in]   str_size_max: Maximum size of the destination string.
+ * \param[in]   str_size: Pointer to the current size of the destination string.
+ * \param[in]   format: null-terminated format string.
+ * \param[in]   ...: Arguments referenced by the format string.
+ * \param[out]  str_size: Pointer to the new size of the destination string.
+ * \retval      Function execution status.
+ *******************************************************************/
+STRING_status_t STRING_append_format(char_t* str, uint32_t str_size_max, uint32_t* str_size, char_t* format, ...) __attribute__((format(printf, 4, 5)));
+
+/*!******************************************************************
+ * \fn STRING_status_t STRING_append_format_va(char_t* str, uint32_t str_size_max, uint32_t* str_size, char_t* format, va_list arguments)
+ * \brief Same as STRING_append_format() with an explicit argument list.
+ * \param[in]   str: Destination string.
+ * \param[in]   str_size_max: Maximum size of the destination string.
+ * \param[in]   str_size: Pointer to the current size of the destination string.
+ * \param[in]   format: null-terminated format string.
+ * \param[in]   arguments: Arguments referenced by the format string.
+ * \param[out]  str_size: Pointer to the new size of the destination string.
+ * \retval      Function execution status.
+ *******************************************************************/
+STRING_status_t STRING_append_format_va(char_t* str, uint32_t str_size_max, uint32_t* str_size, char_t* format, va_list arguments) __attribute__((format(printf, 4, 0)));
+
 /*******************************************************************/
 #define STRING_exit_error(base) { ERROR_check_exit(string_status, STRING_SUCCESS, base) }
 
@@ -11,6 +11,7 @@
 #ifndef EMBEDDED_UTILS_DISABLE_FLAGS_FILE
 #include "embedded_utils_flags.h"
 #endif
+#include "cobs.h"
 #include "error.h"
 #include "strings.h"
 #include "types.h"
@@ -26,10 +27,16 @@ typedef enum {
     TERMINAL_SUCCESS = 0,
     TERMINAL_ERROR_NULL_PARAMETER,
     TERMINAL_ERROR_INSTANCE,
+    TERMINAL_ERROR_TX_BUFFER_SIZE,
+    TERMINAL_ERROR_TX_BUFFER_OVERFLOW,
+    TERMINAL_ERROR_TX_QUEUE_FULL,
+    TERMINAL_ERROR_FLOW_CONTROL,
+    TERMINAL_ERROR_FLOW_CONTROL_LEVEL,
     // Low level drivers errors.
     TERMINAL_ERROR_HW_FUNCTION_NOT_IMPLEMENTED,
     TERMINAL_ERROR_BASE_STRING = ERROR_BASE_STEP,
-    TERMINAL_ERROR_BASE_HW_INTERFACE = (TERMINAL_ERROR_BASE_STRING + STRING_ERROR_BASE_LAST),
+    TERMINAL_ERROR_BASE_COBS = (TERMINAL_ERROR_BASE_STRING + STRING_ERROR_BASE_LAST),
+    TERMINAL_ERROR_BASE_HW_INTERFACE = (TERMINAL_ERROR_BASE_COBS + COBS_ERROR_BASE_LAST),
     // Last base value.
     TERMINAL_ERROR_BASE_LAST = (TERMINAL_ERROR_BASE_HW_INTERFACE + EMBEDDED_UTILS_HW_INTERFACE_ERROR_BASE_LAST)
 } TERMINAL_status_t;
@@ -42,10 +49,47 @@ typedef enum {
  *******************************************************************/
 typedef void (*TERMINAL_rx_irq_cb_t)(uint8_t data);
 
+#ifdef EMBEDDED_UTILS_TERMINAL_HALF_DUPLEX
+/*!******************************************************************
+ * \fn TERMINAL_tx_complete_irq_cb_t
+ * \brief Transmission complete interrupt callback.
+ *******************************************************************/
+typedef void (*TERMINAL_tx_complete_irq_cb_t)(uint8_t instance);
+#endif
+
+#ifdef EMBEDDED_UTILS_TERMINAL_STATISTICS
+/*!******************************************************************
+ * \struct TERMINAL_statistics_t
+ * \brief Terminal TX path statistics.
+ *******************************************************************/
+typedef struct {
+    uint32_t tx_bytes_count;
+    uint32_t tx_write_count;
+    uint32_t tx_buffer_size_max;
+    uint32_t tx_buffer_high_water_mark;
+    uint32_t tx_buffer_overflow_count;
+    uint32_t tx_blocked_time;
+} TERMINAL_statistics_t;
+#endif
+
+#ifdef EMBEDDED_UTILS_TERMINAL_FLOW_CONTROL
+/*!******************************************************************
+ * \enum TERMINAL_flow_control_t
+ * \brief Terminal RX flow control modes.
+ *******************************************************************/
+typedef enum {
+    TERMINAL_FLOW_CONTROL_NONE = 0,
+    TERMINAL_FLOW_CONTROL_HARDWARE,
+    TERMINAL_FLOW_CONTROL_SOFTWARE,
+    TERMINAL_FLOW_CONTROL_LAST
+} TERMINAL_flow_control_t;
+#endif
+
 /*** TERMINAL functions ***/
 
+#ifdef EMBEDDED_UTILS_TERMINAL_BUFFER_SIZE
 /*!******************************************************************
- * \fn TERMINAL_status_t TERMINAL_open(uint8_t instance, TERMINAL_rx_irq_cb_t rx_irq_callback)
+ * \fn TERMINAL_status_t TERMINAL_open(uint8_t instance, uint32_t baud_rate, TERMINAL_rx_irq_cb_t rx_irq_callback)
  * \brief Open a terminal with a physical interface to print and receive data.
  * \param[in]   instance: Terminal instance to initialize.
  * \param[in]   baud_rate: Terminal baud rate.
@@ -54,6 +98,20 @@ typedef void (*TERMINAL_rx_irq_cb_t)(uint8_t data);
  * \retval      Function execution status.
  *******************************************************************/
 TERMINAL_status_t TERMINAL_open(uint8_t instance, uint32_t baud_rate, TERMINAL_rx_irq_cb_t rx_irq_callback);
+#else
+/*!******************************************************************
+ * \fn TERMINAL_status_t TERMINAL_open(uint8_t instance, uint32_t baud_rate, char_t* tx_buffer, uint32_t tx_buffer_size, TERMINAL_rx_irq_cb_t rx_irq_callback)
+ * \brief Open a terminal with a physical interface to print and receive data.
+ * \param[in]   instance: Terminal instance to initialize.
+ * \param[in]   baud_rate: Terminal baud rate.
+ * \param[in]   tx_buffer: TX buffer to use for this instance, which must remain valid until the terminal is closed.
+ * \param[in]   tx_buffer_size: Size of the TX buffer.
+ * \param[in]   rx_irq_callback: Function to be called when a byte is received.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+TERMINAL_status_t TERMINAL_open(uint8_t instance, uint32_t baud_rate, char_t* tx_buffer, uint32_t tx_buffer_size, TERMINAL_rx_irq_cb_t rx_irq_callback);
+#endif
 
 /*!******************************************************************
  * \fn TERMINAL_status_t TERMINAL_close(uint8_t instance)
@@ -101,6 +159,16 @@ TERMINAL_status_t TERMINAL_flush_tx_buffer(uint8_t instance);
  *******************************************************************/
 TERMINAL_status_t TERMINAL_tx_buffer_add_string(uint8_t instance, char_t* str);
 
+/*!******************************************************************
+ * \fn TERMINAL_status_t TERMINAL_tx_buffer_add_view(uint8_t instance, STRING_view_t view)
+ * \brief Print a string view on terminal.
+ * \param[in]   instance: Terminal instance to use.
+ * \param[in]   view: String view to add.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+TERMINAL_status_t TERMINAL_tx_buffer_add_view(uint8_t instance, STRING_view_t view);
+
 /*!******************************************************************
  * \fn TERMINAL_status_t TERMINAL_tx_buffer_add_integer(uint8_t instance, int32_t value, TERMINAL_format_t format, uint8_t print_prefix)
  * \brief Print a value on terminal.
@@ -113,6 +181,22 @@ TERMINAL_status_t TERMINAL_tx_buffer_add_string(uint8_t instance, char_t* str);
  *******************************************************************/
 TERMINAL_status_t TERMINAL_tx_buffer_add_integer(uint8_t instance, int32_t value, STRING_format_t format, uint8_t print_prefix);
 
+/*!******************************************************************
+ * \fn TERMINAL_status_t TERMINAL_tx_buffer_add_integer_array(uint8_t instance, void* data, STRING_array_type_t data_type, uint32_t data_size, STRING_format_t format, uint8_t print_prefix, char_t separator)
+ * \brief Print an integer array on terminal, with a separator between values.
+ * \brief The buffer is sent and flushed each time it is full, so that the array size is not limited by the buffer size.
+ * \param[in]   instance: Terminal instance to use.
+ * \param[in]   data: Integer array to print.
+ * \param[in]   data_type: Type of the array elements.
+ * \param[in]   data_size: Number of elements in the array.
+ * \param[in]   format: Format of the output string.
+ * \param[in]   print_prefix: Print the base prefix of each value if non zero.
+ * \param[in]   separator: Character printed between values (STRING_CHAR_NULL for none).
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+TERMINAL_status_t TERMINAL_tx_buffer_add_integer_array(uint8_t instance, void* data, STRING_array_type_t data_type, uint32_t data_size, STRING_format_t format, uint8_t print_prefix, char_t separator);
+
 /*!******************************************************************
  * \fn TERMINAL_status_t TERMINAL_tx_buffer_add_byte_array(uint8_t instance, uint8_t* data, uint32_t data_size_bytes, uint8_t print_prefix)
  * \brief Print a byte array on terminal.
@@ -125,6 +209,52 @@ TERMINAL_status_t TERMINAL_tx_buffer_add_integer(uint8_t instance, int32_t value
  *******************************************************************/
 TERMINAL_status_t TERMINAL_tx_buffer_add_byte_array(uint8_t instance, uint8_t* data, uint32_t data_size_bytes, uint8_t print_prefix);
 
+/*!******************************************************************
+ * \fn TERMINAL_status_t TERMINAL_tx_buffer_add_data(uint8_t instance, uint8_t* data, uint32_t data_size_bytes)
+ * \brief Add raw binary data to the terminal buffer.
+ * \param[in]   instance: Terminal instance to use.
+ * \param[in]   data: Bytes to add.
+ * \param[in]   data_size_bytes: Number of bytes to add.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+TERMINAL_status_t TERMINAL_tx_buffer_add_data(uint8_t instance, uint8_t* data, uint32_t data_size_bytes);
+
+/*!******************************************************************
+ * \fn TERMINAL_status_t TERMINAL_tx_buffer_add_format(uint8_t instance, char_t* format, ...)
+ * \brief Print a formatted message on terminal (see STRING_append_format() for supported specifiers).
+ * \param[in]   instance: Terminal instance to use.
+ * \param[in]   format: null-terminated format string.
+ * \param[in]   ...: Arguments referenced by the format string.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+TERMINAL_status_t TERMINAL_tx_buffer_add_format(uint8_t instance, char_t* format, ...) __attribute__((format(printf, 2, 3)));
+
+/*!******************************************************************
+ * \fn TERMINAL_status_t TERMINAL_tx_buffer_add_format_va(uint8_t instance, char_t* format, va_list arguments)
+ * \brief Print a formatted message on terminal with an explicit argument list.
+ * \param[in]   instance: Terminal instance to use.
+ * \param[in]   format: null-terminated format string.
+ * \param[in]   arguments: Arguments referenced by the format string.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+TERMINAL_status_t TERMINAL_tx_buffer_add_format_va(uint8_t instance, char_t* format, va_list arguments) __attribute__((format(printf, 2, 0)));
+
+#ifndef EMBEDDED_UTILS_COBS_DRIVER_DISABLE
+/*!******************************************************************
+ * \fn TERMINAL_status_t TERMINAL_tx_buffer_add_cobs_frame(uint8_t instance, uint8_t* data, uint32_t data_size_bytes)
+ * \brief Encode binary data as a COBS frame directly into the terminal buffer.
+ * \param[in]   instance: Terminal instance to use.
+ * \param[in]   data: Bytes to encode.
+ * \param[in]   data_size_bytes: Number of bytes to encode.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+TERMINAL_status_t TERMINAL_tx_buffer_add_cobs_frame(uint8_t instance, uint8_t* data, uint32_t data_size_bytes);
+#endif
+
 /*!******************************************************************
  * \fn TERMINAL_status_t TERMINAL_send_tx_buffer(uint8_t instance)
  * \brief Write the buffer on terminal.
@@ -134,6 +264,17 @@ TERMINAL_status_t TERMINAL_tx_buffer_add_byte_array(uint8_t instance, uint8_t* d
  *******************************************************************/
 TERMINAL_status_t TERMINAL_send_tx_buffer(uint8_t instance);
 
+/*!******************************************************************
+ * \fn TERMINAL_status_t TERMINAL_send_data(uint8_t instance, uint8_t* data, uint32_t data_size_bytes)
+ * \brief Write raw data on terminal without using the TX buffer, whose content is kept.
+ * \param[in]   instance: Terminal instance to use.
+ * \param[in]   data: Bytes to write.
+ * \param[in]   data_size_bytes: Number of bytes to write.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+TERMINAL_status_t TERMINAL_send_data(uint8_t instance, uint8_t* data, uint32_t data_size_bytes);
+
 #ifdef EMBEDDED_UTILS_TERMINAL_MODE_BUS
 /*!******************************************************************
  * \fn void TERMINAL_set_destination_address(uint8_t instance, uint8_t destination_address)
@@ -146,6 +287,93 @@ TERMINAL_status_t TERMINAL_send_tx_buffer(uint8_t instance);
 TERMINAL_status_t TERMINAL_set_destination_address(uint8_t instance, uint8_t destination_address);
 #endif
 
+#if ((defined EMBEDDED_UTILS_TERMINAL_MODE_BUS) && (defined EMBEDDED_UTILS_TERMINAL_BUS_QUEUE_SIZE))
+/*!******************************************************************
+ * \fn TERMINAL_status_t TERMINAL_queue_tx_buffer(uint8_t instance, uint8_t destination_address)
+ * \brief Move the buffer content into the TX queue and flush the buffer.
+ * \param[in]   instance: Terminal instance to use.
+ * \param[in]   destination_address: Address to use when sending the message.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+TERMINAL_status_t TERMINAL_queue_tx_buffer(uint8_t instance, uint8_t destination_address);
+
+/*!******************************************************************
+ * \fn TERMINAL_status_t TERMINAL_send_tx_queue(uint8_t instance)
+ * \brief Send all queued messages, grouped by destination address so that the address is set only once per group.
+ * \brief The queue is emptied whatever the result.
+ * \param[in]   instance: Terminal instance to use.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+TERMINAL_status_t TERMINAL_send_tx_queue(uint8_t instance);
+#endif
+
+#ifdef EMBEDDED_UTILS_TERMINAL_STATISTICS
+/*!******************************************************************
+ * \fn TERMINAL_status_t TERMINAL_get_statistics(uint8_t instance, TERMINAL_statistics_t* statistics)
+ * \brief Read the TX path statistics of a terminal.
+ * \brief Blocked time is expressed in the unit of the TERMINAL_HW_get_timestamp() function.
+ * \param[in]   instance: Terminal instance to use.
+ * \param[out]  statistics: Pointer to the statistics.
+ * \retval      Function execution status.
+ *******************************************************************/
+TERMINAL_status_t TERMINAL_get_statistics(uint8_t instance, TERMINAL_statistics_t* statistics);
+
+/*!******************************************************************
+ * \fn TERMINAL_status_t TERMINAL_reset_statistics(uint8_t instance)
+ * \brief Reset the TX path statistics of a terminal.
+ * \param[in]   instance: Terminal instance to use.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+TERMINAL_status_t TERMINAL_reset_statistics(uint8_t instance);
+
+/*!******************************************************************
+ * \fn TERMINAL_status_t TERMINAL_get_timestamp(uint32_t* timestamp)
+ * \brief Read the free running timestamp used by the terminal statistics.
+ * \param[in]   none
+ * \param[out]  timestamp: Pointer to the current timestamp.
+ * \retval      Function execution status.
+ *******************************************************************/
+TERMINAL_status_t TERMINAL_get_timestamp(uint32_t* timestamp);
+#endif
+
+#ifdef EMBEDDED_UTILS_TERMINAL_FLOW_CONTROL
+/*!******************************************************************
+ * \fn TERMINAL_status_t TERMINAL_configure_flow_control(uint8_t instance, TERMINAL_flow_control_t flow_control, uint32_t rx_level_high, uint32_t rx_level_low)
+ * \brief Configure the RX flow control of a terminal. Flow control is disabled when the terminal is opened.
+ * \param[in]   instance: Terminal instance to use.
+ * \param[in]   flow_control: Flow control mode.
+ * \param[in]   rx_level_high: Consumer buffer level above which the sender is stopped.
+ * \param[in]   rx_level_low: Consumer buffer level below which the sender is released.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+TERMINAL_status_t TERMINAL_configure_flow_control(uint8_t instance, TERMINAL_flow_control_t flow_control, uint32_t rx_level_high, uint32_t rx_level_low);
+
+/*!******************************************************************
+ * \fn TERMINAL_status_t TERMINAL_update_rx_level(uint8_t instance, uint32_t rx_level)
+ * \brief Give the current fill level of the consumer buffer. This function can be called in the RX interrupt.
+ * \brief In software mode, the XON or XOFF character is written here by TERMINAL_HW_write_control_char().
+ * \brief If this function is not implemented, the character is written by the next transmission or TERMINAL_send_flow_control() call.
+ * \param[in]   instance: Terminal instance to use.
+ * \param[in]   rx_level: Number of received bytes not yet processed.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+TERMINAL_status_t TERMINAL_update_rx_level(uint8_t instance, uint32_t rx_level);
+
+/*!******************************************************************
+ * \fn TERMINAL_status_t TERMINAL_send_flow_control(uint8_t instance)
+ * \brief Send the pending XON or XOFF character in software mode when TERMINAL_HW_write_control_char() is not implemented. This function must be called in the main context.
+ * \param[in]   instance: Terminal instance to use.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+TERMINAL_status_t TERMINAL_send_flow_control(uint8_t instance);
+#endif
+
 /*******************************************************************/
 #define TERMINAL_exit_error(base) { ERROR_check_exit(terminal_status, TERMINAL_SUCCESS, base) }
 
@@ -11,11 +11,31 @@
 #ifndef EMBEDDED_UTILS_DISABLE_FLAGS_FILE
 #include "embedded_utils_flags.h"
 #endif
+#include "error.h"
 #include "terminal.h"
 #include "types.h"
 
 #if (!(defined EMBEDDED_UTILS_TERMINAL_DRIVER_DISABLE) && (EMBEDDED_UTILS_TERMINAL_INSTANCES_NUMBER > 0))
 
+#ifdef EMBEDDED_UTILS_TERMINAL_HW_POSIX
+/*** TERMINAL HW structures ***/
+
+/*!******************************************************************
+ * \enum TERMINAL_HW_POSIX_status_t
+ * \brief POSIX terminal interface error codes, returned from the TERMINAL_ERROR_BASE_HW_INTERFACE base.
+ *******************************************************************/
+typedef enum {
+    // Driver errors.
+    TERMINAL_HW_POSIX_SUCCESS = 0,
+    TERMINAL_HW_POSIX_ERROR_STATE,
+    TERMINAL_HW_POSIX_ERROR_OPEN,
+    TERMINAL_HW_POSIX_ERROR_RX_THREAD,
+    TERMINAL_HW_POSIX_ERROR_WRITE,
+    // Last base value.
+    TERMINAL_HW_POSIX_ERROR_BASE_LAST = ERROR_BASE_STEP
+} TERMINAL_HW_POSIX_status_t;
+#endif
+
 /*** TERMINAL HW functions ***/
 
 /*!******************************************************************
@@ -79,6 +99,74 @@ TERMINAL_status_t TERMINAL_HW_write(uint8_t instance, uint8_t* data, uint32_t da
 TERMINAL_status_t TERMINAL_HW_set_destination_address(uint8_t instance, uint8_t destination_address);
 #endif
 
+#ifdef EMBEDDED_UTILS_TERMINAL_STATISTICS
+/*!******************************************************************
+ * \fn TERMINAL_status_t TERMINAL_HW_get_timestamp(uint32_t* timestamp)
+ * \brief Read a free running timestamp used to measure the time spent in TERMINAL_HW_write().
+ * \param[in]   none
+ * \param[out]  timestamp: Pointer to the current timestamp.
+ * \retval      Function execution status.
+ *******************************************************************/
+TERMINAL_status_t TERMINAL_HW_get_timestamp(uint32_t* timestamp);
+#endif
+
+#ifdef EMBEDDED_UTILS_TERMINAL_FLOW_CONTROL
+/*!******************************************************************
+ * \fn TERMINAL_status_t TERMINAL_HW_set_rts(uint8_t instance, uint8_t rx_allowed)
+ * \brief Drive the RTS line of a terminal hardware interface.
+ * \param[in]   instance: Terminal instance to use.
+ * \param[in]   rx_allowed: Allow the remote device to send data if non zero, ask it to stop otherwise.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+TERMINAL_status_t TERMINAL_HW_set_rts(uint8_t instance, uint8_t rx_allowed);
+
+/*!******************************************************************
+ * \fn TERMINAL_status_t TERMINAL_HW_write_control_char(uint8_t instance, uint8_t control_char)
+ * \brief Write a single flow control character ahead of any pending transmission. This function is called in the RX interrupt.
+ * \brief If this function is not implemented, the character is written by the main context.
+ * \param[in]   instance: Terminal instance to use.
+ * \param[in]   control_char: XON or XOFF character to send.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+TERMINAL_status_t TERMINAL_HW_write_control_char(uint8_t instance, uint8_t control_char);
+#endif
+
+#ifdef EMBEDDED_UTILS_TERMINAL_HALF_DUPLEX
+/*!******************************************************************
+ * \fn TERMINAL_status_t TERMINAL_HW_set_driver_enable(uint8_t instance, uint8_t tx_enable)
+ * \brief Drive the transceiver direction of a half-duplex terminal hardware interface.
+ * \param[in]   instance: Terminal instance to use.
+ * \param[in]   tx_enable: Enable the line driver if non zero, release the line otherwise.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+TERMINAL_status_t TERMINAL_HW_set_driver_enable(uint8_t instance, uint8_t tx_enable);
+
+/*!******************************************************************
+ * \fn TERMINAL_status_t TERMINAL_HW_enable_tx_complete_irq(uint8_t instance, TERMINAL_tx_complete_irq_cb_t tx_complete_irq_callback)
+ * \brief Arm a single transmission complete interrupt, raised when the last stop bit has been sent.
+ * \brief If this function is not implemented, the transmission is considered complete when TERMINAL_HW_write() returns.
+ * \param[in]   instance: Terminal instance to use.
+ * \param[in]   tx_complete_irq_callback: Function to be called on transmission complete.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+TERMINAL_status_t TERMINAL_HW_enable_tx_complete_irq(uint8_t instance, TERMINAL_tx_complete_irq_cb_t tx_complete_irq_callback);
+#endif
+
+#ifdef EMBEDDED_UTILS_TERMINAL_HW_POSIX
+/*!******************************************************************
+ * \fn TERMINAL_status_t TERMINAL_HW_POSIX_get_device_name(uint8_t instance, char_t** device_name)
+ * \brief Get the pseudo-terminal device associated to a terminal instance.
+ * \param[in]   instance: Terminal instance to use.
+ * \param[out]  device_name: Pointer that will be set to the null-terminated device path.
+ * \retval      Function execution status.
+ *******************************************************************/
+TERMINAL_status_t TERMINAL_HW_POSIX_get_device_name(uint8_t instance, char_t** device_name);
+#endif
+
 #endif /* EMBEDDED_UTILS_TERMINAL_DRIVER_DISABLE */
 
 #endif /* __TERMINAL_HW_H__ */
@@ -0,0 +1,153 @@
+/*
+ * trace.h
+ *
+ *  Created on: 19 oct. 2026
+ *      Author: Ludo
+ */
+
+#ifndef __TRACE_H__
+#define __TRACE_H__
+
+#ifndef EMBEDDED_UTILS_DISABLE_FLAGS_FILE
+#include "embedded_utils_flags.h"
+#endif
+#include "cobs.h"
+#include "error.h"
+#include "strings.h"
+#include "terminal.h"
+#include "types.h"
+
+/*** TRACE macros ***/
+
+#define TRACE_ARGUMENTS_NUMBER_MAX  4
+
+/*** TRACE structures ***/
+
+/*!******************************************************************
+ * \enum TRACE_status_t
+ * \brief TRACE driver error codes.
+ *******************************************************************/
+typedef enum {
+    // Driver errors.
+    TRACE_SUCCESS = 0,
+    TRACE_ERROR_NULL_PARAMETER,
+    TRACE_ERROR_OUTPUT_MODE,
+    // Low level drivers errors.
+    TRACE_ERROR_BASE_TERMINAL = ERROR_BASE_STEP,
+    TRACE_ERROR_BASE_STRING = (TRACE_ERROR_BASE_TERMINAL + TERMINAL_ERROR_BASE_LAST),
+    TRACE_ERROR_BASE_COBS = (TRACE_ERROR_BASE_STRING + STRING_ERROR_BASE_LAST),
+    // Last base value.
+    TRACE_ERROR_BASE_LAST = (TRACE_ERROR_BASE_COBS + COBS_ERROR_BASE_LAST)
+} TRACE_status_t;
+
+#if (!(defined EMBEDDED_UTILS_TRACE_DRIVER_DISABLE) && (EMBEDDED_UTILS_TRACE_BUFFER_DEPTH > 0))
+
+/*!******************************************************************
+ * \enum TRACE_output_mode_t
+ * \brief TRACE output modes.
+ * \brief Binary events are sent as COBS frames containing the format ID (16 bits), the arguments count (8 bits), the timestamp and the arguments (32 bits each), all in little endian.
+ *******************************************************************/
+typedef enum {
+    TRACE_OUTPUT_MODE_BINARY = 0,
+    TRACE_OUTPUT_MODE_TEXT,
+    TRACE_OUTPUT_MODE_LAST
+} TRACE_output_mode_t;
+
+/*!******************************************************************
+ * \fn TRACE_get_timestamp_cb_t
+ * \brief Function returning the current timestamp.
+ *******************************************************************/
+typedef uint32_t (*TRACE_get_timestamp_cb_t)(void);
+
+/*!******************************************************************
+ * \fn TRACE_critical_section_cb_t
+ * \brief Function entering or exiting a critical section (typically disabling and restoring interrupts).
+ *******************************************************************/
+typedef void (*TRACE_critical_section_cb_t)(void);
+
+/*!******************************************************************
+ * \struct TRACE_configuration_t
+ * \brief TRACE driver configuration structure.
+ *******************************************************************/
+typedef struct {
+    uint8_t terminal_instance;
+    TRACE_output_mode_t output_mode;
+    TRACE_get_timestamp_cb_t get_timestamp_callback;
+    const char_t* const* format_table;
+    uint16_t format_table_size;
+    TRACE_critical_section_cb_t enter_critical_section_callback;
+    TRACE_critical_section_cb_t exit_critical_section_callback;
+} TRACE_configuration_t;
+
+/*** TRACE functions ***/
+
+/*!******************************************************************
+ * \fn TRACE_status_t TRACE_init(TRACE_configuration_t* configuration)
+ * \brief Initialize the trace buffer.
+ * \brief The terminal instance must be opened by the application.
+ * \param[in]   configuration: Pointer to the TRACE configuration structure.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+TRACE_status_t TRACE_init(TRACE_configuration_t* configuration);
+
+/*!******************************************************************
+ * \fn void TRACE_log(uint16_t format_id, uint8_t arguments_count, uint32_t argument_1, uint32_t argument_2, uint32_t argument_3, uint32_t argument_4)
+ * \brief Record an event in the trace buffer without any formatting. The event is dropped if the buffer is full.
+ * \brief The critical section callbacks are required when events are logged from several contexts (main and interrupts), otherwise there must be a single producer.
+ * \param[in]   format_id: Index of the event format string.
+ * \param[in]   arguments_count: Number of valid arguments.
+ * \param[in]   argument_1: First raw argument.
+ * \param[in]   argument_2: Second raw argument.
+ * \param[in]   argument_3: Third raw argument.
+ * \param[in]   argument_4: Fourth raw argument.
+ * \param[out]  none
+ * \retval      none
+ *******************************************************************/
+void TRACE_log(uint16_t format_id, uint8_t arguments_count, uint32_t argument_1, uint32_t argument_2, uint32_t argument_3, uint32_t argument_4);
+
+/*!******************************************************************
+ * \fn uint32_t TRACE_get_lost_events_count(void)
+ * \brief Get the number of events dropped because the trace buffer was full.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      Number of lost events.
+ *******************************************************************/
+uint32_t TRACE_get_lost_events_count(void);
+
+/*!******************************************************************
+ * \fn TRACE_status_t TRACE_process(void)
+ * \brief Send all recorded events on the terminal. This function is designed to be called when the system is idle.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+TRACE_status_t TRACE_process(void);
+
+/*******************************************************************/
+#define TRACE_log_0(format_id) TRACE_log(format_id, 0, 0, 0, 0, 0)
+
+/*******************************************************************/
+#define TRACE_log_1(format_id, a1) TRACE_log(format_id, 1, (uint32_t) (a1), 0, 0, 0)
+
+/*******************************************************************/
+#define TRACE_log_2(format_id, a1, a2) TRACE_log(format_id, 2, (uint32_t) (a1), (uint32_t) (a2), 0, 0)
+
+/*******************************************************************/
+#define TRACE_log_3(format_id, a1, a2, a3) TRACE_log(format_id, 3, (uint32_t) (a1), (uint32_t) (a2), (uint32_t) (a3), 0)
+
+/*******************************************************************/
+#define TRACE_log_4(format_id, a1, a2, a3, a4) TRACE_log(format_id, 4, (uint32_t) (a1), (uint32_t) (a2), (uint32_t) (a3), (uint32_t) (a4))
+
+/*******************************************************************/
+#define TRACE_exit_error(base) { ERROR_check_exit(trace_status, TRACE_SUCCESS, base) }
+
+/*******************************************************************/
+#define TRACE_stack_error(base) { ERROR_check_stack(trace_status, TRACE_SUCCESS, base) }
+
+/*******************************************************************/
+#define TRACE_stack_exit_error(base, code) { ERROR_check_stack_exit(trace_status, TRACE_SUCCESS, base, code) }
+
+#endif /* EMBEDDED_UTILS_TRACE_DRIVER_DISABLE */
+
+#endif /* __TRACE_H__ */
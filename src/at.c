@@ -11,6 +11,7 @@
 #include "embedded_utils_flags.h"
 #endif
 #include "error.h"
+#include "mux.h"
 #include "parser.h"
 #include "terminal.h"
 #include "types.h"
@@ -25,6 +26,38 @@
 #define AT_REPLY_ERROR  "ERROR:"
 #define AT_REPLY_TAB    "    "
 
+#ifdef EMBEDDED_UTILS_AT_MUX
+// Replies are built locally and queued on the channel at once.
+#define AT_REPLY_BUFFER_SIZE    EMBEDDED_UTILS_MUX_BUFFER_SIZE
+#endif
+
+// Flow control and statistics only apply to a dedicated terminal.
+#if ((defined EMBEDDED_UTILS_TERMINAL_FLOW_CONTROL) && !(defined EMBEDDED_UTILS_AT_MUX))
+#define AT_FLOW_CONTROL
+#endif
+#if ((defined EMBEDDED_UTILS_TERMINAL_STATISTICS) && !(defined EMBEDDED_UTILS_AT_MUX))
+#define AT_TERMINAL_STATISTICS
+#endif
+
+#ifdef AT_FLOW_CONTROL
+#define AT_RX_LEVEL_HIGH    ((EMBEDDED_UTILS_AT_BUFFER_SIZE * 3) / 4)
+#define AT_RX_LEVEL_LOW     (EMBEDDED_UTILS_AT_BUFFER_SIZE / 4)
+#endif
+
+#ifdef EMBEDDED_UTILS_AT_BENCHMARK
+// Checked before any use of the terminal timestamp to get a meaningful error.
+#ifndef EMBEDDED_UTILS_TERMINAL_STATISTICS
+#error "embedded-utils: Terminal statistics are required by AT benchmark"
+#endif
+#ifdef EMBEDDED_UTILS_AT_MUX
+#error "embedded-utils: AT benchmark requires a dedicated terminal"
+#endif
+#define AT_BENCHMARK_CHUNK_SIZE         32
+#define AT_BENCHMARK_PATTERN_PERIOD     95
+// Printable characters only, so that the pattern never contains any end marker.
+#define AT_BENCHMARK_PATTERN(idx)       ((char_t) (STRING_CHAR_SPACE + ((idx) % AT_BENCHMARK_PATTERN_PERIOD)))
+#endif
+
 /*** AT local structures ***/
 
 /*******************************************************************/
@@ -37,19 +70,43 @@ typedef union {
         uint8_t process_pending :1;
         uint8_t process :1;
         uint8_t irq_enable :1;
+#ifdef EMBEDDED_UTILS_AT_BENCHMARK
+        uint8_t benchmark_rx :1;
+        uint8_t benchmark_report :1;
+#endif
     } __attribute__((scalar_storage_order("big-endian"))) __attribute__((packed));
 } AT_flags_t;
 
+#ifdef EMBEDDED_UTILS_AT_BENCHMARK
+/*******************************************************************/
+typedef struct {
+    uint32_t rx_size;
+    volatile uint32_t rx_count;
+    volatile uint32_t rx_errors;
+    volatile uint32_t rx_start_time;
+    volatile uint32_t rx_end_time;
+} AT_benchmark_t;
+#endif
+
 /*******************************************************************/
 typedef struct {
     volatile AT_flags_t flags;
     AT_process_callback_t process_callback;
+#ifdef EMBEDDED_UTILS_AT_MUX
+    uint8_t mux_channel;
+    char_t reply_buffer[AT_REPLY_BUFFER_SIZE];
+    uint32_t reply_buffer_size;
+#else
     uint8_t terminal_instance;
+#endif
     const AT_command_t* commands_list[EMBEDDED_UTILS_AT_COMMANDS_LIST_SIZE];
     uint8_t commands_count;
     char_t rx_buffer[EMBEDDED_UTILS_AT_BUFFER_SIZE];
     uint32_t rx_buffer_size;
     PARSER_context_t parser;
+#ifdef EMBEDDED_UTILS_AT_BENCHMARK
+    AT_benchmark_t benchmark;
+#endif
 } AT_context_t;
 
 /*** AT local functions declaration ***/
@@ -58,6 +115,13 @@ typedef struct {
 static AT_status_t _AT_print_commands_list(void);
 static AT_status_t _AT_print_error_stack(void);
 static AT_status_t _AT_print_informations(void);
+#ifdef AT_TERMINAL_STATISTICS
+static AT_status_t _AT_print_terminal_statistics(void);
+#endif
+#ifdef EMBEDDED_UTILS_AT_BENCHMARK
+static AT_status_t _AT_benchmark_tx(void);
+static AT_status_t _AT_benchmark_rx(void);
+#endif
 #endif
 
 /*** AT local global variables ***/
@@ -87,7 +151,29 @@ static const AT_command_t AT_INTERNAL_COMMANDS_LIST[] = {
         .parameters = NULL,
         .description = "Read error stack",
         .callback = &_AT_print_error_stack
-    }
+    },
+#ifdef AT_TERMINAL_STATISTICS
+    {
+        .syntax = "$TERMINAL?",
+        .parameters = NULL,
+        .description = "Read terminal TX statistics",
+        .callback = &_AT_print_terminal_statistics
+    },
+#endif
+#ifdef EMBEDDED_UTILS_AT_BENCHMARK
+    {
+        .syntax = "$BENCHTX=",
+        .parameters = "<size[dec]>",
+        .description = "Send a pattern of the given size and print the elapsed time",
+        .callback = &_AT_benchmark_tx
+    },
+    {
+        .syntax = "$BENCHRX=",
+        .parameters = "<size[dec]>",
+        .description = "Check an incoming pattern of the given size (aborted by CR or LF) and print the result",
+        .callback = &_AT_benchmark_rx
+    },
+#endif
 };
 #endif
 
@@ -95,8 +181,52 @@ static AT_context_t at_ctx;
 
 /*** AT local functions ***/
 
+#ifdef EMBEDDED_UTILS_AT_BENCHMARK
+/*******************************************************************/
+static void _AT_benchmark_rx_irq_callback(uint8_t data) {
+    // Local variables.
+    uint32_t timestamp = 0;
+    // Ignore end markers of the benchmark command itself.
+    if ((at_ctx.benchmark.rx_count == 0) && ((data == STRING_CHAR_CR) || (data == STRING_CHAR_LF))) goto errors;
+    // Start measurement on first pattern byte.
+    if (at_ctx.benchmark.rx_count == 0) {
+        TERMINAL_get_timestamp(&timestamp);
+        at_ctx.benchmark.rx_start_time = timestamp;
+    }
+    // End markers abort the benchmark.
+    if ((data != STRING_CHAR_CR) && (data != STRING_CHAR_LF)) {
+        // Check pattern.
+        if (((char_t) data) != AT_BENCHMARK_PATTERN(at_ctx.benchmark.rx_count)) {
+            at_ctx.benchmark.rx_errors++;
+        }
+        at_ctx.benchmark.rx_count++;
+        if (at_ctx.benchmark.rx_count < at_ctx.benchmark.rx_size) goto errors;
+    }
+    TERMINAL_get_timestamp(&timestamp);
+    at_ctx.benchmark.rx_end_time = timestamp;
+    // Ask for result printing.
+    at_ctx.flags.benchmark_rx = 0;
+    at_ctx.flags.benchmark_report = 1;
+    at_ctx.flags.process = 1;
+    if ((at_ctx.process_callback != NULL) && (at_ctx.flags.process_pending == 0)) {
+        // Ensure callback is called only once.
+        at_ctx.flags.process_pending = 1;
+        at_ctx.process_callback();
+    }
+errors:
+    return;
+}
+#endif
+
 /*******************************************************************/
 static void _AT_rx_irq_callback(uint8_t data) {
+#ifdef EMBEDDED_UTILS_AT_BENCHMARK
+    // Bypass command buffer during benchmark.
+    if ((at_ctx.flags.benchmark_rx != 0) && (at_ctx.flags.irq_enable != 0)) {
+        _AT_benchmark_rx_irq_callback(data);
+        goto errors;
+    }
+#endif
     // Ignore null data.
     if ((data == 0x00) || (at_ctx.flags.irq_enable == 0)) goto errors;
     // Check end marker.
@@ -114,6 +244,9 @@ static void _AT_rx_irq_callback(uint8_t data) {
         // Store new byte in buffer.
         at_ctx.rx_buffer[at_ctx.rx_buffer_size] = (char_t) data;
         at_ctx.rx_buffer_size = (at_ctx.rx_buffer_size + 1) % EMBEDDED_UTILS_AT_BUFFER_SIZE;
+#ifdef AT_FLOW_CONTROL
+        TERMINAL_update_rx_level(at_ctx.terminal_instance, at_ctx.rx_buffer_size);
+#endif
     }
 errors:
     return;
@@ -208,6 +341,129 @@ static AT_status_t _AT_print_informations(void) {
 #endif
     return status;
 }
+
+#ifdef AT_TERMINAL_STATISTICS
+/*******************************************************************/
+static AT_status_t _AT_print_terminal_statistics(void) {
+    // Local variables.
+    AT_status_t status = AT_SUCCESS;
+    TERMINAL_status_t terminal_status = TERMINAL_SUCCESS;
+    TERMINAL_statistics_t statistics;
+    // Read statistics.
+    terminal_status = TERMINAL_get_statistics(at_ctx.terminal_instance, &statistics);
+    TERMINAL_exit_error(AT_ERROR_BASE_TERMINAL);
+    // Print counters.
+    AT_reply_add_format("tx_bytes=%lu", (unsigned long) statistics.tx_bytes_count);
+    AT_send_reply();
+    AT_reply_add_format("tx_writes=%lu", (unsigned long) statistics.tx_write_count);
+    AT_send_reply();
+    AT_reply_add_format("tx_buffer=%lu/%lu", (unsigned long) statistics.tx_buffer_high_water_mark, (unsigned long) statistics.tx_buffer_size_max);
+    AT_send_reply();
+    AT_reply_add_format("tx_overflows=%lu", (unsigned long) statistics.tx_buffer_overflow_count);
+    AT_send_reply();
+    AT_reply_add_format("tx_blocked_time=%lu", (unsigned long) statistics.tx_blocked_time);
+    AT_send_reply();
+errors:
+    return status;
+}
+#endif
+
+#ifdef EMBEDDED_UTILS_AT_BENCHMARK
+/*******************************************************************/
+static AT_status_t _AT_benchmark_tx(void) {
+    // Local variables.
+    AT_status_t status = AT_SUCCESS;
+    PARSER_status_t parser_status = PARSER_SUCCESS;
+    TERMINAL_status_t terminal_status = TERMINAL_SUCCESS;
+    uint8_t chunk[AT_BENCHMARK_CHUNK_SIZE];
+    int32_t size = 0;
+    uint32_t idx = 0;
+    uint32_t chunk_size = 0;
+    uint32_t start_time = 0;
+    uint32_t end_time = 0;
+    // Read size.
+    parser_status = PARSER_get_parameter(&(at_ctx.parser), STRING_FORMAT_DECIMAL, STRING_CHAR_NULL, &size);
+    PARSER_exit_error(AT_ERROR_BASE_PARSER);
+    if (size <= 0) {
+        status = AT_ERROR_BENCHMARK_SIZE;
+        goto errors;
+    }
+    terminal_status = TERMINAL_get_timestamp(&start_time);
+    TERMINAL_exit_error(AT_ERROR_BASE_TERMINAL);
+    // Stream pattern.
+    while (idx < ((uint32_t) size)) {
+        // Build chunk.
+        for (chunk_size = 0; (chunk_size < AT_BENCHMARK_CHUNK_SIZE) && (idx < ((uint32_t) size)); chunk_size++) {
+            chunk[chunk_size] = (uint8_t) AT_BENCHMARK_PATTERN(idx);
+            idx++;
+        }
+        // Write chunk directly, so that the measure does not include any buffer copy.
+        terminal_status = TERMINAL_send_data(at_ctx.terminal_instance, chunk, chunk_size);
+        TERMINAL_exit_error(AT_ERROR_BASE_TERMINAL);
+    }
+    terminal_status = TERMINAL_get_timestamp(&end_time);
+    TERMINAL_exit_error(AT_ERROR_BASE_TERMINAL);
+    // Print result.
+    AT_reply_add_format("tx_bytes=%lu ticks=%lu", (unsigned long) idx, (unsigned long) (end_time - start_time));
+    AT_send_reply();
+errors:
+    return status;
+}
+#endif
+
+#ifdef EMBEDDED_UTILS_AT_BENCHMARK
+/*******************************************************************/
+static AT_status_t _AT_benchmark_rx(void) {
+    // Local variables.
+    AT_status_t status = AT_SUCCESS;
+    PARSER_status_t parser_status = PARSER_SUCCESS;
+    int32_t size = 0;
+    // Read size.
+    parser_status = PARSER_get_parameter(&(at_ctx.parser), STRING_FORMAT_DECIMAL, STRING_CHAR_NULL, &size);
+    PARSER_exit_error(AT_ERROR_BASE_PARSER);
+    if (size <= 0) {
+        status = AT_ERROR_BENCHMARK_SIZE;
+        goto errors;
+    }
+    // Reset counters.
+    at_ctx.benchmark.rx_size = (uint32_t) size;
+    at_ctx.benchmark.rx_count = 0;
+    at_ctx.benchmark.rx_errors = 0;
+    at_ctx.benchmark.rx_start_time = 0;
+    at_ctx.benchmark.rx_end_time = 0;
+    // Next received bytes will be routed to the benchmark.
+    at_ctx.flags.benchmark_rx = 1;
+errors:
+    return status;
+}
+#endif
+
+#ifdef EMBEDDED_UTILS_AT_BENCHMARK
+/*******************************************************************/
+static AT_status_t _AT_print_benchmark_rx(void) {
+    // Local variables.
+    AT_status_t status = AT_SUCCESS;
+    // Print result.
+    AT_reply_add_format("rx_bytes=%lu errors=%lu ticks=%lu", (unsigned long) at_ctx.benchmark.rx_count, (unsigned long) at_ctx.benchmark.rx_errors, (unsigned long) (at_ctx.benchmark.rx_end_time - at_ctx.benchmark.rx_start_time));
+    AT_send_reply();
+    return status;
+}
+#endif
+#endif
+
+#ifdef EMBEDDED_UTILS_AT_MUX
+/*******************************************************************/
+static void _AT_write_reply(void) {
+    // Local variables.
+    MUX_status_t mux_status = MUX_SUCCESS;
+    // Queue reply on the channel and send it immediately, as on a dedicated terminal.
+    mux_status = MUX_write(at_ctx.mux_channel, (uint8_t*) at_ctx.reply_buffer, at_ctx.reply_buffer_size);
+    MUX_stack_error(AT_ERROR_BASE_MUX);
+    mux_status = MUX_process();
+    MUX_stack_error(AT_ERROR_BASE_MUX);
+    // Release reply buffer in all cases since the replies are never retried.
+    at_ctx.reply_buffer_size = 0;
+}
 #endif
 
 /*******************************************************************/
@@ -236,7 +492,11 @@ static void _AT_print_ok(void) {
 /*******************************************************************/
 static void _AT_print_error(AT_status_t at_status) {
     // Erase eventual pending reply.
+#ifdef EMBEDDED_UTILS_AT_MUX
+    at_ctx.reply_buffer_size = 0;
+#else
     TERMINAL_flush_tx_buffer(at_ctx.terminal_instance);
+#endif
     // Reply error code.
     AT_reply_add_string(AT_REPLY_ERROR);
     AT_reply_add_integer((int32_t) at_status, STRING_FORMAT_HEXADECIMAL, 0);
@@ -249,7 +509,12 @@ static void _AT_print_error(AT_status_t at_status) {
 AT_status_t AT_init(AT_configuration_t* configuration, PARSER_context_t** parser_context_ptr) {
     // Local variables.
     AT_status_t status = AT_SUCCESS;
+#ifdef EMBEDDED_UTILS_AT_MUX
+    MUX_status_t mux_status = MUX_SUCCESS;
+#else
     TERMINAL_status_t terminal_status = TERMINAL_SUCCESS;
+    uint32_t baud_rate = 0;
+#endif
     uint8_t idx = 0;
     // Check parameters.
     if ((configuration == NULL) || (parser_context_ptr == NULL)) {
@@ -263,7 +528,12 @@ AT_status_t AT_init(AT_configuration_t* configuration, PARSER_context_t** parser
     // Init context.
     at_ctx.flags.all = 0;
     at_ctx.process_callback = (configuration->process_callback);
+#ifdef EMBEDDED_UTILS_AT_MUX
+    at_ctx.mux_channel = (configuration->mux_channel);
+    at_ctx.reply_buffer_size = 0;
+#else
     at_ctx.terminal_instance = (configuration->terminal_instance);
+#endif
     for (idx = 0; idx < EMBEDDED_UTILS_AT_COMMANDS_LIST_SIZE; idx++) {
         at_ctx.commands_list[idx] = NULL;
     }
@@ -277,18 +547,35 @@ AT_status_t AT_init(AT_configuration_t* configuration, PARSER_context_t** parser
         AT_register_command(&(AT_INTERNAL_COMMANDS_LIST[idx]));
     }
 #endif
+#ifdef EMBEDDED_UTILS_AT_MUX
+    // Enable interrupt.
+    at_ctx.flags.irq_enable = 1;
+    // Attach receiver to the channel.
+    mux_status = MUX_set_rx_irq_callback(at_ctx.mux_channel, &_AT_rx_irq_callback);
+    MUX_exit_error(AT_ERROR_BASE_MUX);
+#else
     // Open terminal.
 #ifdef EMBEDDED_UTILS_AT_BAUD_RATE
-    terminal_status = TERMINAL_open(at_ctx.terminal_instance, EMBEDDED_UTILS_AT_BAUD_RATE, &_AT_rx_irq_callback);
+    baud_rate = EMBEDDED_UTILS_AT_BAUD_RATE;
+#else
+    baud_rate = (configuration->terminal_baud_rate);
+#endif
+#ifdef EMBEDDED_UTILS_TERMINAL_BUFFER_SIZE
+    terminal_status = TERMINAL_open(at_ctx.terminal_instance, baud_rate, &_AT_rx_irq_callback);
 #else
-    terminal_status = TERMINAL_open(at_ctx.terminal_instance, (configuration->terminal_baud_rate), &_AT_rx_irq_callback);
+    terminal_status = TERMINAL_open(at_ctx.terminal_instance, baud_rate, (configuration->terminal_tx_buffer), (configuration->terminal_tx_buffer_size), &_AT_rx_irq_callback);
 #endif
     TERMINAL_exit_error(AT_ERROR_BASE_TERMINAL);
+#ifdef AT_FLOW_CONTROL
+    terminal_status = TERMINAL_configure_flow_control(at_ctx.terminal_instance, (configuration->terminal_flow_control), AT_RX_LEVEL_HIGH, AT_RX_LEVEL_LOW);
+    TERMINAL_exit_error(AT_ERROR_BASE_TERMINAL);
+#endif
     // Enable interrupt.
     at_ctx.flags.irq_enable = 1;
     // Enable receiver.
     terminal_status = TERMINAL_enable_rx(at_ctx.terminal_instance);
     TERMINAL_exit_error(AT_ERROR_BASE_TERMINAL);
+#endif
 errors:
     return status;
 }
@@ -297,14 +584,24 @@ errors:
 AT_status_t AT_de_init(void) {
     // Local variables.
     AT_status_t status = AT_SUCCESS;
+#ifdef EMBEDDED_UTILS_AT_MUX
+    MUX_status_t mux_status = MUX_SUCCESS;
+#else
     TERMINAL_status_t terminal_status = TERMINAL_SUCCESS;
+#endif
     // Disable interrupt.
     at_ctx.flags.irq_enable = 0;
+#ifdef EMBEDDED_UTILS_AT_MUX
+    // Detach receiver from the channel.
+    mux_status = MUX_set_rx_irq_callback(at_ctx.mux_channel, NULL);
+    MUX_exit_error(AT_ERROR_BASE_MUX);
+#else
     // Disable receiver.
     TERMINAL_disable_rx(at_ctx.terminal_instance);
     // Close terminal.
     terminal_status = TERMINAL_close(at_ctx.terminal_instance);
     TERMINAL_exit_error(AT_ERROR_BASE_TERMINAL);
+#endif
 errors:
     return status;
 }
@@ -315,17 +612,32 @@ AT_status_t AT_process(void) {
     AT_status_t status = AT_ERROR_UNKOWN_COMMAND;
     PARSER_mode_t parser_mode = PARSER_MODE_STRICT;
     uint8_t command_idx = 0;
+#ifdef AT_FLOW_CONTROL
+    uint8_t release_sender = 0;
+    // Send XOFF requested by the RX interrupt if the hardware interface could not write it.
+    TERMINAL_send_flow_control(at_ctx.terminal_instance);
+#endif
     // Check process flag.
     if (at_ctx.flags.process == 0) goto errors;
     // Disable interrupt and clear flag.
     at_ctx.flags.irq_enable = 0;
     at_ctx.flags.process = 0;
+#ifndef EMBEDDED_UTILS_AT_MUX
     // Disable receiver.
     TERMINAL_disable_rx(at_ctx.terminal_instance);
+#endif
     // Update parser and reset reply flag.
     at_ctx.parser.buffer_size = at_ctx.rx_buffer_size;
 #ifndef EMBEDDED_UTILS_AT_FORCE_OK
     at_ctx.flags.reply_sent = 0;
+#endif
+#if ((defined EMBEDDED_UTILS_AT_INTERNAL_COMMANDS_ENABLE) && (defined EMBEDDED_UTILS_AT_BENCHMARK))
+    // Check benchmark result.
+    if (at_ctx.flags.benchmark_report != 0) {
+        at_ctx.flags.benchmark_report = 0;
+        status = _AT_print_benchmark_rx();
+        goto end;
+    }
 #endif
     // Check header.
     if (PARSER_compare(&(at_ctx.parser), PARSER_MODE_HEADER, AT_HEADER) == PARSER_SUCCESS) {
@@ -360,12 +672,24 @@ end:
 #endif
     }
     _AT_reset_parser();
+#ifdef AT_FLOW_CONTROL
+    release_sender = 1;
+#endif
     // Enable interrupt.
     at_ctx.flags.process_pending = 0;
     at_ctx.flags.irq_enable = 1;
 errors:
+#ifndef EMBEDDED_UTILS_AT_MUX
     // Enable receiver.
     TERMINAL_enable_rx(at_ctx.terminal_instance);
+#endif
+#ifdef AT_FLOW_CONTROL
+    // Release the sender only once the receiver is able to store new bytes.
+    if (release_sender != 0) {
+        TERMINAL_update_rx_level(at_ctx.terminal_instance, at_ctx.rx_buffer_size);
+        TERMINAL_send_flow_control(at_ctx.terminal_instance);
+    }
+#endif
     return status;
 }
 
@@ -436,27 +760,78 @@ errors:
 /*******************************************************************/
 void AT_reply_add_string(char_t* str) {
     // Add string.
+#ifdef EMBEDDED_UTILS_AT_MUX
+    STRING_append_string(at_ctx.reply_buffer, AT_REPLY_BUFFER_SIZE, str, &(at_ctx.reply_buffer_size));
+#else
     TERMINAL_tx_buffer_add_string(at_ctx.terminal_instance, str);
+#endif
 }
 
 /*******************************************************************/
 void AT_reply_add_integer(int32_t value, STRING_format_t format, uint8_t print_prefix) {
     // Add integer.
+#ifdef EMBEDDED_UTILS_AT_MUX
+    STRING_append_integer(at_ctx.reply_buffer, AT_REPLY_BUFFER_SIZE, value, format, print_prefix, &(at_ctx.reply_buffer_size));
+#else
     TERMINAL_tx_buffer_add_integer(at_ctx.terminal_instance, value, format, print_prefix);
+#endif
+}
+
+/*******************************************************************/
+void AT_reply_add_integer_array(void* data, STRING_array_type_t data_type, uint32_t data_size, STRING_format_t format, uint8_t print_prefix, char_t separator) {
+#ifdef EMBEDDED_UTILS_AT_MUX
+    // Local variables.
+    STRING_status_t string_status = STRING_SUCCESS;
+    uint32_t data_index = 0;
+    // Add integer array.
+    while (1) {
+        string_status = STRING_append_integer_array(at_ctx.reply_buffer, AT_REPLY_BUFFER_SIZE, data, data_type, data_size, format, print_prefix, separator, &(at_ctx.reply_buffer_size), &data_index);
+        // Exit if all values have been appended or if a value does not fit in an empty buffer.
+        if ((string_status != STRING_ERROR_APPEND_OVERFLOW) || (at_ctx.reply_buffer_size == 0)) break;
+        // Send full buffer and continue from the first value which did not fit.
+        _AT_write_reply();
+    }
+#else
+    // Add integer array.
+    TERMINAL_tx_buffer_add_integer_array(at_ctx.terminal_instance, data, data_type, data_size, format, print_prefix, separator);
+#endif
 }
 
 /*******************************************************************/
 void AT_reply_add_byte_array(uint8_t* data, uint32_t data_size_bytes, uint8_t print_prefix) {
     // Add byte array.
+#ifdef EMBEDDED_UTILS_AT_MUX
+    STRING_append_byte_array(at_ctx.reply_buffer, AT_REPLY_BUFFER_SIZE, data, data_size_bytes, print_prefix, &(at_ctx.reply_buffer_size));
+#else
     TERMINAL_tx_buffer_add_byte_array(at_ctx.terminal_instance, data, data_size_bytes, print_prefix);
+#endif
+}
+
+/*******************************************************************/
+void AT_reply_add_format(char_t* format, ...) {
+    // Local variables.
+    va_list arguments;
+    // Add formatted string.
+    va_start(arguments, format);
+#ifdef EMBEDDED_UTILS_AT_MUX
+    STRING_append_format_va(at_ctx.reply_buffer, AT_REPLY_BUFFER_SIZE, &(at_ctx.reply_buffer_size), format, arguments);
+#else
+    TERMINAL_tx_buffer_add_format_va(at_ctx.terminal_instance, format, arguments);
+#endif
+    va_end(arguments);
 }
 
 /*******************************************************************/
 void AT_send_reply(void) {
     // Add the ending marker.
+#ifdef EMBEDDED_UTILS_AT_MUX
+    STRING_append_string(at_ctx.reply_buffer, AT_REPLY_BUFFER_SIZE, EMBEDDED_UTILS_AT_REPLY_END, &(at_ctx.reply_buffer_size));
+    _AT_write_reply();
+#else
     TERMINAL_tx_buffer_add_string(at_ctx.terminal_instance, EMBEDDED_UTILS_AT_REPLY_END);
     TERMINAL_send_tx_buffer(at_ctx.terminal_instance);
     TERMINAL_flush_tx_buffer(at_ctx.terminal_instance);
+#endif
 #ifndef EMBEDDED_UTILS_AT_FORCE_OK
     // Update flag.
     at_ctx.flags.reply_sent = 1;
@@ -468,5 +843,8 @@ void AT_send_reply(void) {
 #if (EMBEDDED_UTILS_TERMINAL_INSTANCES_NUMBER == 0)
 #error "embedded-utils: Terminal instance missing for AT driver"
 #endif
+#if ((defined EMBEDDED_UTILS_AT_MUX) && ((defined EMBEDDED_UTILS_MUX_DRIVER_DISABLE) || (EMBEDDED_UTILS_MUX_CHANNELS_NUMBER == 0)))
+#error "embedded-utils: MUX channel missing for AT driver"
+#endif
 
 #endif /* EMBEDDED_UTILS_AT_DRIVER_DISABLE */
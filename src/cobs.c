@@ -0,0 +1,163 @@
+/*
+ * cobs.c
+ *
+ *  Created on: 19 oct. 2026
+ *      Author: Ludo
+ */
+
+#include "cobs.h"
+
+#ifndef EMBEDDED_UTILS_DISABLE_FLAGS_FILE
+#include "embedded_utils_flags.h"
+#endif
+#include "error.h"
+#include "types.h"
+
+#ifndef EMBEDDED_UTILS_COBS_DRIVER_DISABLE
+
+/*** COBS local macros ***/
+
+// Code of a full block, which is not followed by an implicit zero.
+#define COBS_BLOCK_CODE_FULL    (COBS_BLOCK_SIZE_MAX + 1)
+
+/*** COBS local functions ***/
+
+/*******************************************************************/
+#define _COBS_check_pointer(ptr) { \
+    if (ptr == NULL) { \
+        status = COBS_ERROR_NULL_PARAMETER; \
+        goto errors; \
+    } \
+}
+
+/*******************************************************************/
+static void _COBS_reset_decoder(COBS_decoder_t* decoder) {
+    // Wait for the first code byte of the next frame.
+    (decoder->block_code) = 0;
+    (decoder->block_remaining_size) = 0;
+    (decoder->discard_flag) = 0;
+}
+
+/*** COBS functions ***/
+
+/*******************************************************************/
+COBS_status_t COBS_encode(uint8_t* buffer, uint32_t buffer_size_max, uint8_t* data, uint32_t data_size_bytes, uint32_t* buffer_size) {
+    // Local variables.
+    COBS_status_t status = COBS_SUCCESS;
+    uint32_t code_idx = 0;
+    uint32_t size = 0;
+    uint8_t code = 1;
+    uint32_t idx = 0;
+    // Check parameters.
+    _COBS_check_pointer(buffer);
+    _COBS_check_pointer(data);
+    _COBS_check_pointer(buffer_size);
+    // Check worst case size once so that the loop does not need any bound check.
+    if (((*buffer_size) > buffer_size_max) || (COBS_FRAME_SIZE_MAX(data_size_bytes) > (buffer_size_max - (*buffer_size)))) {
+        status = COBS_ERROR_ENCODING_OVERFLOW;
+        goto errors;
+    }
+    size = (*buffer_size);
+    // Reserve first code byte.
+    code_idx = size++;
+    // Data loop.
+    for (idx = 0; idx < data_size_bytes; idx++) {
+        if (data[idx] == COBS_FRAME_DELIMITER) {
+            // Close current block.
+            buffer[code_idx] = code;
+            code_idx = size++;
+            code = 1;
+        }
+        else {
+            buffer[size++] = data[idx];
+            code++;
+            // Close full block.
+            if (code == COBS_BLOCK_CODE_FULL) {
+                buffer[code_idx] = code;
+                code_idx = size++;
+                code = 1;
+            }
+        }
+    }
+    // Close last block and add delimiter.
+    buffer[code_idx] = code;
+    buffer[size++] = COBS_FRAME_DELIMITER;
+    (*buffer_size) = size;
+errors:
+    return status;
+}
+
+/*******************************************************************/
+COBS_status_t COBS_init_decoder(COBS_decoder_t* decoder, uint8_t* buffer, uint32_t buffer_size_max) {
+    // Local variables.
+    COBS_status_t status = COBS_SUCCESS;
+    // Check parameters.
+    _COBS_check_pointer(decoder);
+    _COBS_check_pointer(buffer);
+    // Init context.
+    (decoder->buffer) = buffer;
+    (decoder->buffer_size_max) = buffer_size_max;
+    (decoder->size) = 0;
+    _COBS_reset_decoder(decoder);
+errors:
+    return status;
+}
+
+/*******************************************************************/
+COBS_status_t COBS_decode_byte(COBS_decoder_t* decoder, uint8_t byte, uint8_t* frame_ready) {
+    // Local variables.
+    COBS_status_t status = COBS_SUCCESS;
+    // Check parameters.
+    _COBS_check_pointer(decoder);
+    _COBS_check_pointer(frame_ready);
+    (*frame_ready) = 0;
+    // Check delimiter.
+    if (byte == COBS_FRAME_DELIMITER) {
+        // Empty or discarded frames are silently dropped.
+        if (((decoder->discard_flag) == 0) && ((decoder->block_code) != 0)) {
+            if ((decoder->block_remaining_size) != 0) {
+                status = COBS_ERROR_FRAME_TRUNCATED;
+            }
+            else {
+                (*frame_ready) = 1;
+            }
+        }
+        _COBS_reset_decoder(decoder);
+        goto errors;
+    }
+    // Skip bytes until next delimiter after an error.
+    if ((decoder->discard_flag) != 0) goto errors;
+    // Check byte type.
+    if ((decoder->block_remaining_size) == 0) {
+        // Code byte.
+        if ((decoder->block_code) == 0) {
+            // First block of a new frame.
+            (decoder->size) = 0;
+        }
+        else if ((decoder->block_code) != COBS_BLOCK_CODE_FULL) {
+            // Previous block was followed by a zero.
+            if ((decoder->size) >= (decoder->buffer_size_max)) {
+                status = COBS_ERROR_DECODING_OVERFLOW;
+                (decoder->discard_flag) = 1;
+                goto errors;
+            }
+            (decoder->buffer)[(decoder->size)++] = COBS_FRAME_DELIMITER;
+        }
+        (decoder->block_code) = byte;
+        (decoder->block_remaining_size) = (uint8_t) (byte - 1);
+    }
+    else {
+        // Data byte.
+        if ((decoder->size) >= (decoder->buffer_size_max)) {
+            status = COBS_ERROR_DECODING_OVERFLOW;
+            (decoder->discard_flag) = 1;
+            goto errors;
+        }
+        (decoder->buffer)[(decoder->size)++] = byte;
+        (decoder->block_remaining_size)--;
+    }
+errors:
+    return status;
+}
+
+#endif /* EMBEDDED_UTILS_COBS_DRIVER_DISABLE */
@@ -0,0 +1,264 @@
+/*
+ * mux.c
+ *
+ *  Created on: 19 oct. 2026
+ *      Author: Ludo
+ */
+
+#include "mux.h"
+
+#ifndef EMBEDDED_UTILS_DISABLE_FLAGS_FILE
+#include "embedded_utils_flags.h"
+#endif
+#include "cobs.h"
+#include "error.h"
+#include "terminal.h"
+#include "types.h"
+
+#if (!(defined EMBEDDED_UTILS_MUX_DRIVER_DISABLE) && (EMBEDDED_UTILS_MUX_CHANNELS_NUMBER > 0))
+
+/*** MUX local macros ***/
+
+#define MUX_FRAME_HEADER_SIZE   1
+#define MUX_FRAME_DATA_SIZE_MAX (MUX_FRAME_HEADER_SIZE + EMBEDDED_UTILS_MUX_FRAME_SIZE_MAX)
+#define MUX_FRAME_SIZE_MAX      COBS_FRAME_SIZE_MAX(MUX_FRAME_DATA_SIZE_MAX)
+
+#define MUX_QUEUE_SIZE          (EMBEDDED_UTILS_MUX_BUFFER_SIZE + 1)
+
+/*** MUX local structures ***/
+
+/*******************************************************************/
+typedef struct {
+    uint8_t queue[MUX_QUEUE_SIZE];
+    volatile uint32_t write_idx;
+    volatile uint32_t read_idx;
+    TERMINAL_rx_irq_cb_t rx_irq_callback;
+} MUX_channel_t;
+
+/*******************************************************************/
+typedef struct {
+    uint8_t terminal_instance;
+    MUX_scheduling_t scheduling;
+    uint8_t last_channel;
+    COBS_decoder_t rx_decoder;
+    uint8_t rx_frame_data[MUX_FRAME_DATA_SIZE_MAX];
+    MUX_channel_t channels[EMBEDDED_UTILS_MUX_CHANNELS_NUMBER];
+    uint8_t tx_frame_data[MUX_FRAME_DATA_SIZE_MAX];
+    uint8_t tx_frame[MUX_FRAME_SIZE_MAX];
+} MUX_context_t;
+
+/*** MUX local global variables ***/
+
+static MUX_context_t mux_ctx;
+
+/*** MUX local functions ***/
+
+/*******************************************************************/
+#define _MUX_get_queue_size(channel_ptr) ((((channel_ptr)->write_idx) + MUX_QUEUE_SIZE - ((channel_ptr)->read_idx)) % MUX_QUEUE_SIZE)
+
+/*******************************************************************/
+static void _MUX_rx_irq_callback(uint8_t data) {
+    // Local variables.
+    MUX_channel_t* channel_ptr = NULL;
+    uint8_t frame_ready = 0;
+    uint32_t idx = 0;
+    // Decode frame, invalid frames are dropped by the decoder until the next delimiter.
+    if (COBS_decode_byte(&(mux_ctx.rx_decoder), data, &frame_ready) != COBS_SUCCESS) goto errors;
+    if (frame_ready == 0) goto errors;
+    // Check channel index and payload size.
+    if ((mux_ctx.rx_decoder.size <= MUX_FRAME_HEADER_SIZE) || (mux_ctx.rx_frame_data[0] >= EMBEDDED_UTILS_MUX_CHANNELS_NUMBER)) goto errors;
+    channel_ptr = &(mux_ctx.channels[mux_ctx.rx_frame_data[0]]);
+    // Forward payload to the channel.
+    if ((channel_ptr->rx_irq_callback) == NULL) goto errors;
+    for (idx = MUX_FRAME_HEADER_SIZE; idx < mux_ctx.rx_decoder.size; idx++) {
+        (channel_ptr->rx_irq_callback)(mux_ctx.rx_frame_data[idx]);
+    }
+errors:
+    return;
+}
+
+/*******************************************************************/
+static uint8_t _MUX_select_channel(void) {
+    // Local variables.
+    uint8_t channel = EMBEDDED_UTILS_MUX_CHANNELS_NUMBER;
+    uint8_t idx = 0;
+    // Search next channel with pending data.
+    for (idx = 0; idx < EMBEDDED_UTILS_MUX_CHANNELS_NUMBER; idx++) {
+        // Priority scheduling always starts from the first channel.
+        channel = (mux_ctx.scheduling == MUX_SCHEDULING_PRIORITY) ? idx : (uint8_t) ((mux_ctx.last_channel + 1 + idx) % EMBEDDED_UTILS_MUX_CHANNELS_NUMBER);
+        if (_MUX_get_queue_size(&(mux_ctx.channels[channel])) != 0) break;
+    }
+    return ((idx < EMBEDDED_UTILS_MUX_CHANNELS_NUMBER) ? channel : EMBEDDED_UTILS_MUX_CHANNELS_NUMBER);
+}
+
+/*******************************************************************/
+static MUX_status_t _MUX_send_frame(uint8_t channel) {
+    // Local variables.
+    MUX_status_t status = MUX_SUCCESS;
+    TERMINAL_status_t terminal_status = TERMINAL_SUCCESS;
+    COBS_status_t cobs_status = COBS_SUCCESS;
+    MUX_channel_t* channel_ptr = &(mux_ctx.channels[channel]);
+    uint32_t read_idx = (channel_ptr->read_idx);
+    uint32_t payload_size = _MUX_get_queue_size(channel_ptr);
+    uint32_t frame_size = 0;
+    uint32_t idx = 0;
+    // Limit payload size.
+    if (payload_size > EMBEDDED_UTILS_MUX_FRAME_SIZE_MAX) {
+        payload_size = EMBEDDED_UTILS_MUX_FRAME_SIZE_MAX;
+    }
+    // Build header.
+    mux_ctx.tx_frame_data[0] = channel;
+    // Copy payload, which may wrap around the end of the queue.
+    for (idx = 0; idx < payload_size; idx++) {
+        mux_ctx.tx_frame_data[MUX_FRAME_HEADER_SIZE + idx] = (channel_ptr->queue)[read_idx];
+        read_idx = (read_idx + 1) % MUX_QUEUE_SIZE;
+    }
+    // Encode frame.
+    cobs_status = COBS_encode(mux_ctx.tx_frame, MUX_FRAME_SIZE_MAX, mux_ctx.tx_frame_data, (MUX_FRAME_HEADER_SIZE + payload_size), &frame_size);
+    COBS_exit_error(MUX_ERROR_BASE_COBS);
+    // Send frame without using the terminal buffer, which may contain data of another user.
+    terminal_status = TERMINAL_send_data(mux_ctx.terminal_instance, mux_ctx.tx_frame, frame_size);
+    TERMINAL_exit_error(MUX_ERROR_BASE_TERMINAL);
+    // Release queue space.
+    (channel_ptr->read_idx) = read_idx;
+errors:
+    return status;
+}
+
+/*** MUX functions ***/
+
+/*******************************************************************/
+MUX_status_t MUX_init(MUX_configuration_t* configuration) {
+    // Local variables.
+    MUX_status_t status = MUX_SUCCESS;
+    TERMINAL_status_t terminal_status = TERMINAL_SUCCESS;
+    COBS_status_t cobs_status = COBS_SUCCESS;
+    uint8_t idx = 0;
+    // Check parameters.
+    if (configuration == NULL) {
+        status = MUX_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    if ((configuration->scheduling) >= MUX_SCHEDULING_LAST) {
+        status = MUX_ERROR_SCHEDULING;
+        goto errors;
+    }
+    // Init context.
+    mux_ctx.terminal_instance = (configuration->terminal_instance);
+    mux_ctx.scheduling = (configuration->scheduling);
+    mux_ctx.last_channel = (EMBEDDED_UTILS_MUX_CHANNELS_NUMBER - 1);
+    cobs_status = COBS_init_decoder(&(mux_ctx.rx_decoder), mux_ctx.rx_frame_data, MUX_FRAME_DATA_SIZE_MAX);
+    COBS_exit_error(MUX_ERROR_BASE_COBS);
+    for (idx = 0; idx < EMBEDDED_UTILS_MUX_CHANNELS_NUMBER; idx++) {
+        mux_ctx.channels[idx].write_idx = 0;
+        mux_ctx.channels[idx].read_idx = 0;
+        mux_ctx.channels[idx].rx_irq_callback = (configuration->rx_irq_callback)[idx];
+    }
+    // Open terminal.
+#ifdef EMBEDDED_UTILS_TERMINAL_BUFFER_SIZE
+    terminal_status = TERMINAL_open(mux_ctx.terminal_instance, (configuration->terminal_baud_rate), &_MUX_rx_irq_callback);
+#else
+    terminal_status = TERMINAL_open(mux_ctx.terminal_instance, (configuration->terminal_baud_rate), (configuration->terminal_tx_buffer), (configuration->terminal_tx_buffer_size), &_MUX_rx_irq_callback);
+#endif
+    TERMINAL_exit_error(MUX_ERROR_BASE_TERMINAL);
+    // Enable receiver.
+    terminal_status = TERMINAL_enable_rx(mux_ctx.terminal_instance);
+    TERMINAL_exit_error(MUX_ERROR_BASE_TERMINAL);
+errors:
+    return status;
+}
+
+/*******************************************************************/
+MUX_status_t MUX_de_init(void) {
+    // Local variables.
+    MUX_status_t status = MUX_SUCCESS;
+    TERMINAL_status_t terminal_status = TERMINAL_SUCCESS;
+    // Disable receiver.
+    TERMINAL_disable_rx(mux_ctx.terminal_instance);
+    // Close terminal.
+    terminal_status = TERMINAL_close(mux_ctx.terminal_instance);
+    TERMINAL_exit_error(MUX_ERROR_BASE_TERMINAL);
+errors:
+    return status;
+}
+
+/*******************************************************************/
+MUX_status_t MUX_write(uint8_t channel, uint8_t* data, uint32_t data_size_bytes) {
+    // Local variables.
+    MUX_status_t status = MUX_SUCCESS;
+    MUX_channel_t* channel_ptr = NULL;
+    uint32_t write_idx = 0;
+    uint32_t idx = 0;
+    // Check parameters.
+    if (channel >= EMBEDDED_UTILS_MUX_CHANNELS_NUMBER) {
+        status = MUX_ERROR_CHANNEL;
+        goto errors;
+    }
+    if (data == NULL) {
+        status = MUX_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    channel_ptr = &(mux_ctx.channels[channel]);
+    // Data is either fully queued or rejected.
+    if (data_size_bytes > (EMBEDDED_UTILS_MUX_BUFFER_SIZE - _MUX_get_queue_size(channel_ptr))) {
+        status = MUX_ERROR_QUEUE_FULL;
+        goto errors;
+    }
+    // Fill queue.
+    write_idx = (channel_ptr->write_idx);
+    for (idx = 0; idx < data_size_bytes; idx++) {
+        (channel_ptr->queue)[write_idx] = data[idx];
+        write_idx = (write_idx + 1) % MUX_QUEUE_SIZE;
+    }
+    (channel_ptr->write_idx) = write_idx;
+errors:
+    return status;
+}
+
+/*******************************************************************/
+MUX_status_t MUX_set_rx_irq_callback(uint8_t channel, TERMINAL_rx_irq_cb_t rx_irq_callback) {
+    // Local variables.
+    MUX_status_t status = MUX_SUCCESS;
+    // Check parameters.
+    if (channel >= EMBEDDED_UTILS_MUX_CHANNELS_NUMBER) {
+        status = MUX_ERROR_CHANNEL;
+        goto errors;
+    }
+    // Update callback.
+    mux_ctx.channels[channel].rx_irq_callback = rx_irq_callback;
+errors:
+    return status;
+}
+
+/*******************************************************************/
+MUX_status_t MUX_process(void) {
+    // Local variables.
+    MUX_status_t status = MUX_SUCCESS;
+    uint8_t channel = 0;
+    // Send one frame at a time and schedule again after each frame.
+    while (1) {
+        channel = _MUX_select_channel();
+        if (channel >= EMBEDDED_UTILS_MUX_CHANNELS_NUMBER) break;
+        status = _MUX_send_frame(channel);
+        if (status != MUX_SUCCESS) goto errors;
+        mux_ctx.last_channel = channel;
+    }
+errors:
+    return status;
+}
+
+/*** MUX compilation flags check ***/
+
+#if (EMBEDDED_UTILS_TERMINAL_INSTANCES_NUMBER == 0)
+#error "embedded-utils: Terminal instance missing for MUX driver"
+#endif
+
+#ifdef EMBEDDED_UTILS_COBS_DRIVER_DISABLE
+#error "embedded-utils: COBS driver required by MUX driver"
+#endif
+
+#if ((EMBEDDED_UTILS_MUX_FRAME_SIZE_MAX == 0) || (EMBEDDED_UTILS_MUX_FRAME_SIZE_MAX > 255))
+#error "embedded-utils: MUX frame size must be between 1 and 255"
+#endif
+
+#endif /* EMBEDDED_UTILS_MUX_DRIVER_DISABLE */
@@ -39,16 +39,16 @@
 static PARSER_status_t _PARSER_search_separator(PARSER_context_t* parser_ctx, char_t separator) {
     // Local variables.
     PARSER_status_t status = PARSER_ERROR_SEPARATOR_NOT_FOUND;
+    STRING_status_t string_status = STRING_SUCCESS;
     uint32_t idx = 0;
     // Check parameters.
     _PARSER_check_pointer(parser_ctx);
+    if ((parser_ctx->start_index) >= (parser_ctx->buffer_size)) goto errors;
     // Starting from int8_t following the current separator (which is the start of buffer in case of first call).
-    for (idx = (parser_ctx->start_index); idx < (parser_ctx->buffer_size); idx++) {
-        if ((parser_ctx->buffer)[idx] == separator) {
-            (parser_ctx->separator_index) = idx;
-            status = PARSER_SUCCESS;
-            break;
-        }
+    string_status = STRING_search_char(&((parser_ctx->buffer)[parser_ctx->start_index]), ((parser_ctx->buffer_size) - (parser_ctx->start_index)), separator, &idx);
+    if (string_status == STRING_SUCCESS) {
+        (parser_ctx->separator_index) = ((parser_ctx->start_index) + idx);
+        status = PARSER_SUCCESS;
     }
 errors:
     return status;
@@ -98,6 +98,80 @@ errors:
     return status;
 }
 
+/*******************************************************************/
+PARSER_status_t PARSER_compare_view(PARSER_context_t* parser_ctx, PARSER_mode_t mode, STRING_view_t reference) {
+    // Local variables.
+    PARSER_status_t status = PARSER_SUCCESS;
+    uint32_t remaining_size = 0;
+    uint32_t idx = 0;
+    // Check parameters.
+    _PARSER_check_pointer(parser_ctx);
+    _PARSER_check_pointer(reference.str);
+    _PARSER_check_size();
+    if ((parser_ctx->start_index) > (parser_ctx->buffer_size)) {
+        status = PARSER_ERROR_REFERENCE_MISMATCH;
+        goto errors;
+    }
+    remaining_size = ((parser_ctx->buffer_size) - (parser_ctx->start_index));
+    // Check size first since reference length is known.
+    switch (mode) {
+    case PARSER_MODE_STRICT:
+        if (remaining_size != reference.size) {
+            status = PARSER_ERROR_REFERENCE_MISMATCH;
+            goto errors;
+        }
+        break;
+    case PARSER_MODE_HEADER:
+        if (remaining_size < reference.size) {
+            status = PARSER_ERROR_REFERENCE_MISMATCH;
+            goto errors;
+        }
+        break;
+    default:
+        // Unknown mode.
+        status = PARSER_ERROR_MODE;
+        goto errors;
+        break;
+    }
+    // Compare all characters.
+    for (idx = 0; idx < reference.size; idx++) {
+        if ((parser_ctx->buffer)[(parser_ctx->start_index) + idx] != reference.str[idx]) {
+            status = PARSER_ERROR_REFERENCE_MISMATCH;
+            goto errors;
+        }
+    }
+    // Update start index.
+    (parser_ctx->start_index) += reference.size;
+errors:
+    return status;
+}
+
+/*******************************************************************/
+PARSER_status_t PARSER_search_view(PARSER_context_t* parser_ctx, STRING_view_t reference) {
+    // Local variables.
+    PARSER_status_t status = PARSER_SUCCESS;
+    STRING_status_t string_status = STRING_SUCCESS;
+    uint32_t idx = 0;
+    // Check parameters.
+    _PARSER_check_pointer(parser_ctx);
+    _PARSER_check_size();
+    if ((parser_ctx->start_index) > (parser_ctx->buffer_size)) {
+        status = PARSER_ERROR_HEADER_NOT_FOUND;
+        goto errors;
+    }
+    // Search reference in the remaining characters.
+    string_status = STRING_search_view(&((parser_ctx->buffer)[parser_ctx->start_index]), ((parser_ctx->buffer_size) - (parser_ctx->start_index)), reference, &idx);
+    if (string_status == STRING_ERROR_SEARCH_NOT_FOUND) {
+        status = PARSER_ERROR_HEADER_NOT_FOUND;
+        goto errors;
+    }
+    STRING_exit_error(PARSER_ERROR_BASE_STRING);
+    // Update start index to the character following the reference.
+    (parser_ctx->start_index) += (idx + reference.size);
+errors:
+    return status;
+}
+
 /*******************************************************************/
 PARSER_status_t PARSER_get_parameter(PARSER_context_t* parser_ctx, STRING_format_t format, char_t separator, int32_t* parameter) {
     // Local variables.
@@ -137,6 +211,84 @@ errors:
     return status;
 }
 
+/*******************************************************************/
+PARSER_status_t PARSER_get_integer(PARSER_context_t* parser_ctx, char_t separator, int32_t* parameter) {
+    // Local variables.
+    PARSER_status_t status = PARSER_SUCCESS;
+    STRING_status_t string_status = STRING_SUCCESS;
+    uint32_t parsed_size = 0;
+    uint32_t end_idx = 0;
+    // Check parameters.
+    _PARSER_check_pointer(parser_ctx);
+    _PARSER_check_pointer(parameter);
+    _PARSER_check_size();
+    // Check if parameter is not empty.
+    if (((parser_ctx->start_index) >= (parser_ctx->buffer_size)) || ((parser_ctx->buffer)[parser_ctx->start_index] == separator)) {
+        status = PARSER_ERROR_PARAMETER_NOT_FOUND;
+        goto errors;
+    }
+    // Convert string up to the first non digit character.
+    string_status = STRING_parse_integer(&((parser_ctx->buffer)[parser_ctx->start_index]), ((parser_ctx->buffer_size) - (parser_ctx->start_index)), parameter, &parsed_size);
+    STRING_exit_error(PARSER_ERROR_BASE_STRING);
+    end_idx = ((parser_ctx->start_index) + parsed_size);
+    // Parameter must be followed by the separator or by the end of the buffer.
+    if (separator != STRING_CHAR_NULL) {
+        if ((end_idx >= (parser_ctx->buffer_size)) || ((parser_ctx->buffer)[end_idx] != separator)) {
+            status = PARSER_ERROR_SEPARATOR_NOT_FOUND;
+            goto errors;
+        }
+        (parser_ctx->separator_index) = end_idx;
+        end_idx++;
+    }
+    else if (end_idx != (parser_ctx->buffer_size)) {
+        status = PARSER_ERROR_SEPARATOR_NOT_FOUND;
+        goto errors;
+    }
+    // Update start index after decoding parameter.
+    (parser_ctx->start_index) = end_idx;
+errors:
+    return status;
+}
+
+/*******************************************************************/
+PARSER_status_t PARSER_get_floating_decimal_parameter(PARSER_context_t* parser_ctx, char_t separator, uint8_t multiplier_exponent, int32_t* parameter) {
+    // Local variables.
+    PARSER_status_t status = PARSER_SUCCESS;
+    STRING_status_t string_status = STRING_SUCCESS;
+    uint32_t end_idx = 0;
+    uint32_t param_size_char = 0;
+    // Check parameters.
+    _PARSER_check_pointer(parser_ctx);
+    _PARSER_check_pointer(parameter);
+    _PARSER_check_size();
+    // Compute end index.
+    if (separator != STRING_CHAR_NULL) {
+        // Search separator.
+        status = _PARSER_search_separator(parser_ctx, separator);
+        if (status != PARSER_SUCCESS) goto errors;
+        end_idx = (parser_ctx->separator_index) - 1;
+    }
+    else {
+        end_idx = (parser_ctx->buffer_size) - 1;
+    }
+    // Compute parameter size.
+    param_size_char = (end_idx - (parser_ctx->start_index) + 1);
+    // Check if parameter is not empty.
+    if (param_size_char == 0) {
+        status = PARSER_ERROR_PARAMETER_NOT_FOUND;
+        goto errors;
+    }
+    // Convert string.
+    string_status = STRING_floating_decimal_string_to_integer(&((parser_ctx->buffer)[parser_ctx->start_index]), param_size_char, multiplier_exponent, parameter);
+    STRING_exit_error(PARSER_ERROR_BASE_STRING);
+    // Update start index after decoding parameter.
+    if ((parser_ctx->separator_index) > 0) {
+        (parser_ctx->start_index) = (parser_ctx->separator_index) + 1;
+    }
+errors:
+    return status;
+}
+
 /*******************************************************************/
 PARSER_status_t PARSER_get_byte_array(PARSER_context_t* parser_ctx, char_t separator, uint32_t maximum_size, uint8_t exact_size, uint8_t* parameter, uint32_t* extracted_size) {
     // Local variables.
@@ -183,4 +335,50 @@ errors:
     return status;
 }
 
+/*******************************************************************/
+PARSER_status_t PARSER_get_base64(PARSER_context_t* parser_ctx, char_t separator, uint32_t maximum_size, uint8_t* parameter, uint32_t* extracted_size) {
+    // Local variables.
+    PARSER_status_t status = PARSER_SUCCESS;
+    STRING_status_t string_status = STRING_SUCCESS;
+    STRING_base64_decoder_t decoder;
+    uint32_t param_size_char = 0;
+    uint32_t end_idx = 0;
+    // Check parameters.
+    _PARSER_check_pointer(parser_ctx);
+    _PARSER_check_pointer(parameter);
+    _PARSER_check_pointer(extracted_size);
+    _PARSER_check_size();
+    // Compute end index.
+    if (separator != STRING_CHAR_NULL) {
+        // Search separator.
+        status = _PARSER_search_separator(parser_ctx, separator);
+        if (status != PARSER_SUCCESS) goto errors;
+        end_idx = (parser_ctx->separator_index) - 1;
+    }
+    else {
+        end_idx = (parser_ctx->buffer_size) - 1;
+    }
+    // Compute parameter size.
+    param_size_char = (end_idx - (parser_ctx->start_index) + 1);
+    // Check if parameter is not empty.
+    if (param_size_char == 0) {
+        status = PARSER_ERROR_PARAMETER_NOT_FOUND;
+        goto errors;
+    }
+    // Decode string.
+    (*extracted_size) = 0;
+    string_status = STRING_base64_init_decoder(&decoder);
+    STRING_exit_error(PARSER_ERROR_BASE_STRING);
+    string_status = STRING_base64_decode(&decoder, &((parser_ctx->buffer)[parser_ctx->start_index]), param_size_char, parameter, maximum_size, extracted_size);
+    STRING_exit_error(PARSER_ERROR_BASE_STRING);
+    string_status = STRING_base64_decode_final(&decoder, parameter, maximum_size, extracted_size);
+    STRING_exit_error(PARSER_ERROR_BASE_STRING);
+    // Update start index after decoding parameter.
+    if ((parser_ctx->separator_index) > 0) {
+        (parser_ctx->start_index) = (parser_ctx->separator_index) + 1;
+    }
+errors:
+    return status;
+}
+
 #endif /* EMBEDDED_UTILS_PARSER_DRIVER_DISABLE */
@@ -0,0 +1,158 @@
+/*
+ * render.c
+ *
+ *  Created on: 19 oct. 2026
+ *      Author: Ludo
+ */
+
+#include "render.h"
+
+#ifndef EMBEDDED_UTILS_DISABLE_FLAGS_FILE
+#include "embedded_utils_flags.h"
+#endif
+#include "error.h"
+#include "strings.h"
+#include "types.h"
+
+#ifndef EMBEDDED_UTILS_RENDER_DRIVER_DISABLE
+
+/*** RENDER local functions ***/
+
+/*******************************************************************/
+#define _RENDER_check_pointer(ptr) { \
+    if (ptr == NULL) { \
+        status = RENDER_ERROR_NULL_PARAMETER; \
+        goto errors; \
+    } \
+}
+
+/*******************************************************************/
+#define _RENDER_frame_line(render_ctx, line_index) (&(((render_ctx)->buffer)[(uint32_t) (line_index) * ((render_ctx)->line_size)]))
+
+/*******************************************************************/
+#define _RENDER_shadow_line(render_ctx, line_index) (&(((render_ctx)->buffer)[(uint32_t) (((render_ctx)->number_of_lines) + (line_index)) * ((render_ctx)->line_size)]))
+
+/*** RENDER functions ***/
+
+/*******************************************************************/
+RENDER_status_t RENDER_init(RENDER_context_t* render_ctx, char_t* buffer, uint8_t number_of_lines, uint8_t line_size, char_t flush_char, uint8_t span_gap_max, RENDER_write_span_cb_t write_span_callback) {
+    // Local variables.
+    RENDER_status_t status = RENDER_SUCCESS;
+    uint32_t idx = 0;
+    // Check parameters.
+    _RENDER_check_pointer(render_ctx);
+    _RENDER_check_pointer(buffer);
+    _RENDER_check_pointer(write_span_callback);
+    if ((number_of_lines == 0) || (line_size == 0)) {
+        status = RENDER_ERROR_FRAME_SIZE;
+        goto errors;
+    }
+    // Init context.
+    (render_ctx->buffer) = buffer;
+    (render_ctx->number_of_lines) = number_of_lines;
+    (render_ctx->line_size) = line_size;
+    (render_ctx->span_gap_max) = span_gap_max;
+    (render_ctx->flush_char) = flush_char;
+    (render_ctx->write_span_callback) = write_span_callback;
+    // Clear working frame, shadow content is unknown until the first refresh.
+    for (idx = 0; idx < ((uint32_t) number_of_lines * line_size); idx++) {
+        buffer[idx] = flush_char;
+    }
+    (render_ctx->redraw_flag) = 1;
+errors:
+    return status;
+}
+
+/*******************************************************************/
+RENDER_status_t RENDER_print(RENDER_context_t* render_ctx, uint8_t line_index, uint8_t column, uint8_t width, char_t* str, STRING_justification_t justification) {
+    // Local variables.
+    RENDER_status_t status = RENDER_SUCCESS;
+    STRING_status_t string_status = STRING_SUCCESS;
+    STRING_copy_t copy;
+    // Check parameters.
+    _RENDER_check_pointer(render_ctx);
+    _RENDER_check_pointer(str);
+    if (line_index >= (render_ctx->number_of_lines)) {
+        status = RENDER_ERROR_LINE_INDEX;
+        goto errors;
+    }
+    if ((width == 0) || (((uint32_t) column + width) > (render_ctx->line_size))) {
+        status = RENDER_ERROR_COLUMN;
+        goto errors;
+    }
+    // Build field in the working frame.
+    copy.source = str;
+    copy.destination = &(_RENDER_frame_line(render_ctx, line_index)[column]);
+    copy.destination_size = width;
+    copy.justification = justification;
+    copy.flush_flag = 1;
+    copy.flush_char = (render_ctx->flush_char);
+    string_status = STRING_copy(&copy);
+    STRING_exit_error(RENDER_ERROR_BASE_STRING);
+errors:
+    return status;
+}
+
+/*******************************************************************/
+RENDER_status_t RENDER_refresh(RENDER_context_t* render_ctx) {
+    // Local variables.
+    RENDER_status_t status = RENDER_SUCCESS;
+    char_t* frame_line = NULL;
+    char_t* shadow_line = NULL;
+    uint8_t line_index = 0;
+    uint8_t column = 0;
+    uint8_t span_start = 0;
+    uint8_t span_end = 0;
+    uint8_t gap_size = 0;
+    // Check parameters.
+    _RENDER_check_pointer(render_ctx);
+    // Lines loop.
+    for (line_index = 0; line_index < (render_ctx->number_of_lines); line_index++) {
+        frame_line = _RENDER_frame_line(render_ctx, line_index);
+        shadow_line = _RENDER_shadow_line(render_ctx, line_index);
+        column = 0;
+        while (column < (render_ctx->line_size)) {
+            // Search next changed character.
+            if (((render_ctx->redraw_flag) == 0) && (frame_line[column] == shadow_line[column])) {
+                column++;
+                continue;
+            }
+            // Extend span while the unchanged gap is short enough.
+            span_start = column;
+            span_end = (column + 1);
+            gap_size = 0;
+            for (column = span_end; column < (render_ctx->line_size); column++) {
+                if (((render_ctx->redraw_flag) != 0) || (frame_line[column] != shadow_line[column])) {
+                    span_end = (column + 1);
+                    gap_size = 0;
+                }
+                else {
+                    gap_size++;
+                    if (gap_size > (render_ctx->span_gap_max)) break;
+                }
+            }
+            // Write span and update shadow.
+            (render_ctx->write_span_callback)(line_index, span_start, &(frame_line[span_start]), (uint8_t) (span_end - span_start));
+            for (; span_start < span_end; span_start++) {
+                shadow_line[span_start] = frame_line[span_start];
+            }
+        }
+    }
+    (render_ctx->redraw_flag) = 0;
+errors:
+    return status;
+}
+
+/*******************************************************************/
+RENDER_status_t RENDER_invalidate(RENDER_context_t* render_ctx) {
+    // Local variables.
+    RENDER_status_t status = RENDER_SUCCESS;
+    // Check parameters.
+    _RENDER_check_pointer(render_ctx);
+    // Write all characters on next refresh.
+    (render_ctx->redraw_flag) = 1;
+errors:
+    return status;
+}
+
+#endif /* EMBEDDED_UTILS_RENDER_DRIVER_DISABLE */
@@ -17,7 +17,21 @@
 
 /*** STRING local macros ***/
 
-#define STRING_VALUE_BUFFER_SIZE            256
+// Hexadecimal characters lookup covers the '0' to 'f' range.
+#define STRING_HEXADECIMAL_VALUE_TABLE_SIZE ('f' - '0' + 1)
+#define STRING_HEXADECIMAL_VALUE_INVALID    0xFF
+// Offset between the character following '9' and the first hexadecimal letter.
+#ifdef EMBEDDED_UTILS_STRING_HEXADECIMAL_UPPER_CASE
+#define STRING_HEXADECIMAL_LETTER_OFFSET    ('A' - '9' - 1)
+#else
+#define STRING_HEXADECIMAL_LETTER_OFFSET    ('a' - '9' - 1)
+#endif
+// Base64 characters lookup covers the '+' to 'z' range.
+#define STRING_BASE64_VALUE_TABLE_SIZE      ('z' - '+' + 1)
+#define STRING_BASE64_VALUE_INVALID         0xFF
+#define STRING_BASE64_PADDING               '='
+// Longest integer representation: sign, base prefix and 32 bits.
+#define STRING_INTEGER_SIZE_MAX             (1 + 2 + MATH_S32_SIZE_BITS)
 #define STRING_SIZE_MAX                     1024
 #ifdef EMBEDDED_UTILS_STRING_HEXADECIMAL_UPPER_CASE
 #define STRING_HEXADECIMAL_LETTER_START     'A'
@@ -25,6 +39,225 @@
 #define STRING_HEXADECIMAL_LETTER_START     'a'
 #endif
 
+#define STRING_FORMAT_MARKER                '%'
+#define STRING_FORMAT_FIELD_SIZE_MAX        (MATH_U32_SIZE_DECIMAL_DIGITS + 2)
+
+// Exact quotient of a 32-bits value by 100 (2^37 / 100 rounded up), avoiding a software division on cores without hardware divider.
+#define STRING_DIVIDE_BY_100_MULTIPLIER     1374389535ULL
+#define STRING_DIVIDE_BY_100_SHIFT          37
+// 64-bits values are converted by chunks of 9 digits (at most 2 chunks below the most significant part).
+#define STRING_DECIMAL_CHUNK_SIZE_DIGITS    9
+#define STRING_DECIMAL_CHUNK_DIVIDER        1000000000ULL
+#define STRING_U64_DECIMAL_CHUNKS_MAX       2
+// Exponent of floating decimal strings is saturated (any larger value overflows or rounds to zero anyway).
+#define STRING_FLOATING_EXPONENT_MAX        9999
+#if (EMBEDDED_UTILS_MATH_PRECISION > 0)
+// Grisu2 parameters: scaled values exponent is kept in the [alpha, gamma] range so that the integral part fits in 32 bits.
+#define STRING_GRISU_ALPHA                  (-60)
+#define STRING_GRISU_GAMMA                  (-32)
+#define STRING_CACHED_POWERS_SIZE           79
+#define STRING_CACHED_POWERS_EXPONENT_MIN   (-300)
+#define STRING_CACHED_POWERS_EXPONENT_STEP  8
+// Grisu2 representation of a double never exceeds 17 digits.
+#define STRING_FLOATING_DIGITS_MAX          17
+// Decimal point position range printed without exponent in shortest mode.
+#define STRING_FLOATING_PLAIN_POSITION_MIN  (-5)
+#define STRING_FLOATING_PLAIN_POSITION_MAX  21
+// Fixed decimals are computed on the exact integer f * 10^decimals * 2^e: with f < 2^53, decimals <= 20 and e <= 70 (above, the value exceeds 10^21) it fits in 192 bits.
+#define STRING_BIGNUM_SIZE_WORDS            6
+#define STRING_BIGNUM_SIZE_BITS             (STRING_BIGNUM_SIZE_WORDS << 5)
+#define STRING_FLOATING_FIXED_EXPONENT_MAX  70
+#define STRING_FLOATING_FIXED_CHUNKS_MAX    7
+#define STRING_FLOATING_FIXED_DIGITS_MAX    (STRING_FLOATING_FIXED_CHUNKS_MAX * STRING_DECIMAL_CHUNK_SIZE_DIGITS)
+#define STRING_FLOAT32_SIGNIFICAND_SIZE_BITS    23
+#define STRING_FLOAT32_EXPONENT_SIZE_BITS       8
+#define STRING_FLOAT64_SIGNIFICAND_SIZE_BITS    52
+#define STRING_FLOAT64_EXPONENT_SIZE_BITS       11
+#endif
+
+/*** STRING local structures ***/
+
+/*******************************************************************/
+typedef uint32_t __attribute__((__may_alias__)) STRING_word_t;
+
+#if (EMBEDDED_UTILS_MATH_PRECISION > 0)
+/*******************************************************************/
+typedef struct {
+    uint64_t f;
+    int32_t e;
+} STRING_diy_fp_t;
+
+/*******************************************************************/
+typedef struct {
+    uint64_t f;
+    int16_t e;
+    int16_t k;
+} STRING_cached_power_t;
+
+/*******************************************************************/
+typedef struct {
+    uint32_t words[STRING_BIGNUM_SIZE_WORDS];
+} STRING_bignum_t;
+
+/*******************************************************************/
+typedef union {
+    float32_t value;
+    uint32_t bits;
+} STRING_float32_t;
+#endif
+
+#if (EMBEDDED_UTILS_MATH_PRECISION == 2)
+/*******************************************************************/
+typedef union {
+    float64_t value;
+    uint64_t bits;
+} STRING_float64_t;
+#endif
+
+/*** STRING local global variables ***/
+
+#ifdef EMBEDDED_UTILS_STRING_HEXADECIMAL_UPPER_CASE
+static const char_t STRING_HEXADECIMAL_CHAR[16] = { '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'A', 'B', 'C', 'D', 'E', 'F' };
+#else
+static const char_t STRING_HEXADECIMAL_CHAR[16] = { '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'a', 'b', 'c', 'd', 'e', 'f' };
+#endif
+
+static const uint8_t STRING_HEXADECIMAL_VALUE[STRING_HEXADECIMAL_VALUE_TABLE_SIZE] = {
+    // '0' to '9'.
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09,
+    // ':' to '@'.
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 'A' to 'F'.
+    0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F,
+    // 'G' to '`'.
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 'a' to 'f'.
+    0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F
+};
+
+static const char_t STRING_BASE64_CHAR[64] = {
+    'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H', 'I', 'J', 'K', 'L', 'M', 'N', 'O', 'P',
+    'Q', 'R', 'S', 'T', 'U', 'V', 'W', 'X', 'Y', 'Z', 'a', 'b', 'c', 'd', 'e', 'f',
+    'g', 'h', 'i', 'j', 'k', 'l', 'm', 'n', 'o', 'p', 'q', 'r', 's', 't', 'u', 'v',
+    'w', 'x', 'y', 'z', '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', '+', '/'
+};
+
+static const uint8_t STRING_BASE64_VALUE[STRING_BASE64_VALUE_TABLE_SIZE] = {
+    // '+' to '/'.
+    0x3E, 0xFF, 0xFF, 0xFF, 0x3F,
+    // '0' to '9'.
+    0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3A, 0x3B, 0x3C, 0x3D,
+    // ':' to '@'.
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 'A' to 'Z'.
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C,
+    0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19,
+    // '[' to '`'.
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    // 'a' to 'z'.
+    0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26,
+    0x27, 0x28, 0x29, 0x2A, 0x2B, 0x2C, 0x2D, 0x2E, 0x2F, 0x30, 0x31, 0x32, 0x33
+};
+
+static const char_t STRING_DECIMAL_DIGIT_PAIRS[200] = {
+    '0','0','0','1','0','2','0','3','0','4','0','5','0','6','0','7','0','8','0','9',
+    '1','0','1','1','1','2','1','3','1','4','1','5','1','6','1','7','1','8','1','9',
+    '2','0','2','1','2','2','2','3','2','4','2','5','2','6','2','7','2','8','2','9',
+    '3','0','3','1','3','2','3','3','3','4','3','5','3','6','3','7','3','8','3','9',
+    '4','0','4','1','4','2','4','3','4','4','4','5','4','6','4','7','4','8','4','9',
+    '5','0','5','1','5','2','5','3','5','4','5','5','5','6','5','7','5','8','5','9',
+    '6','0','6','1','6','2','6','3','6','4','6','5','6','6','6','7','6','8','6','9',
+    '7','0','7','1','7','2','7','3','7','4','7','5','7','6','7','7','7','8','7','9',
+    '8','0','8','1','8','2','8','3','8','4','8','5','8','6','8','7','8','8','8','9',
+    '9','0','9','1','9','2','9','3','9','4','9','5','9','6','9','7','9','8','9','9'
+};
+
+#if (EMBEDDED_UTILS_MATH_PRECISION > 0)
+// Normalized 64-bits approximations of 10^k, for k = -300 to 324 by steps of 8.
+static const STRING_cached_power_t STRING_CACHED_POWERS[STRING_CACHED_POWERS_SIZE] = {
+    { 0xAB70FE17C79AC6CAULL, -1060, -300 },
+    { 0xFF77B1FCBEBCDC4FULL, -1034, -292 },
+    { 0xBE5691EF416BD60CULL, -1007, -284 },
+    { 0x8DD01FAD907FFC3CULL,  -980, -276 },
+    { 0xD3515C2831559A83ULL,  -954, -268 },
+    { 0x9D71AC8FADA6C9B5ULL,  -927, -260 },
+    { 0xEA9C227723EE8BCBULL,  -901, -252 },
+    { 0xAECC49914078536DULL,  -874, -244 },
+    { 0x823C12795DB6CE57ULL,  -847, -236 },
+    { 0xC21094364DFB5637ULL,  -821, -228 },
+    { 0x9096EA6F3848984FULL,  -794, -220 },
+    { 0xD77485CB25823AC7ULL,  -768, -212 },
+    { 0xA086CFCD97BF97F4ULL,  -741, -204 },
+    { 0xEF340A98172AACE5ULL,  -715, -196 },
+    { 0xB23867FB2A35B28EULL,  -688, -188 },
+    { 0x84C8D4DFD2C63F3BULL,  -661, -180 },
+    { 0xC5DD44271AD3CDBAULL,  -635, -172 },
+    { 0x936B9FCEBB25C996ULL,  -608, -164 },
+    { 0xDBAC6C247D62A584ULL,  -582, -156 },
+    { 0xA3AB66580D5FDAF6ULL,  -555, -148 },
+    { 0xF3E2F893DEC3F126ULL,  -529, -140 },
+    { 0xB5B5ADA8AAFF80B8ULL,  -502, -132 },
+    { 0x87625F056C7C4A8BULL,  -475, -124 },
+    { 0xC9BCFF6034C13053ULL,  -449, -116 },
+    { 0x964E858C91BA2655ULL,  -422, -108 },
+    { 0xDFF9772470297EBDULL,  -396, -100 },
+    { 0xA6DFBD9FB8E5B88FULL,  -369,  -92 },
+    { 0xF8A95FCF88747D94ULL,  -343,  -84 },
+    { 0xB94470938FA89BCFULL,  -316,  -76 },
+    { 0x8A08F0F8BF0F156BULL,  -289,  -68 },
+    { 0xCDB02555653131B6ULL,  -263,  -60 },
+    { 0x993FE2C6D07B7FACULL,  -236,  -52 },
+    { 0xE45C10C42A2B3B06ULL,  -210,  -44 },
+    { 0xAA242499697392D3ULL,  -183,  -36 },
+    { 0xFD87B5F28300CA0EULL,  -157,  -28 },
+    { 0xBCE5086492111AEBULL,  -130,  -20 },
+    { 0x8CBCCC096F5088CCULL,  -103,  -12 },
+    { 0xD1B71758E219652CULL,   -77,   -4 },
+    { 0x9C40000000000000ULL,   -50,    4 },
+    { 0xE8D4A51000000000ULL,   -24,   12 },
+    { 0xAD78EBC5AC620000ULL,     3,   20 },
+    { 0x813F3978F8940984ULL,    30,   28 },
+    { 0xC097CE7BC90715B3ULL,    56,   36 },
+    { 0x8F7E32CE7BEA5C70ULL,    83,   44 },
+    { 0xD5D238A4ABE98068ULL,   109,   52 },
+    { 0x9F4F2726179A2245ULL,   136,   60 },
+    { 0xED63A231D4C4FB27ULL,   162,   68 },
+    { 0xB0DE65388CC8ADA8ULL,   189,   76 },
+    { 0x83C7088E1AAB65DBULL,   216,   84 },
+    { 0xC45D1DF942711D9AULL,   242,   92 },
+    { 0x924D692CA61BE758ULL,   269,  100 },
+    { 0xDA01EE641A708DEAULL,   295,  108 },
+    { 0xA26DA3999AEF774AULL,   322,  116 },
+    { 0xF209787BB47D6B85ULL,   348,  124 },
+    { 0xB454E4A179DD1877ULL,   375,  132 },
+    { 0x865B86925B9BC5C2ULL,   402,  140 },
+    { 0xC83553C5C8965D3DULL,   428,  148 },
+    { 0x952AB45CFA97A0B3ULL,   455,  156 },
+    { 0xDE469FBD99A05FE3ULL,   481,  164 },
+    { 0xA59BC234DB398C25ULL,   508,  172 },
+    { 0xF6C69A72A3989F5CULL,   534,  180 },
+    { 0xB7DCBF5354E9BECEULL,   561,  188 },
+    { 0x88FCF317F22241E2ULL,   588,  196 },
+    { 0xCC20CE9BD35C78A5ULL,   614,  204 },
+    { 0x98165AF37B2153DFULL,   641,  212 },
+    { 0xE2A0B5DC971F303AULL,   667,  220 },
+    { 0xA8D9D1535CE3B396ULL,   694,  228 },
+    { 0xFB9B7CD9A4A7443CULL,   720,  236 },
+    { 0xBB764C4CA7A44410ULL,   747,  244 },
+    { 0x8BAB8EEFB6409C1AULL,   774,  252 },
+    { 0xD01FEF10A657842CULL,   800,  260 },
+    { 0x9B10A4E5E9913129ULL,   827,  268 },
+    { 0xE7109BFBA19C0C9DULL,   853,  276 },
+    { 0xAC2820D9623BF429ULL,   880,  284 },
+    { 0x80444B5E7AA7CF85ULL,   907,  292 },
+    { 0xBF21E44003ACDD2DULL,   933,  300 },
+    { 0x8E679C2F5E44FF8FULL,   960,  308 },
+    { 0xD433179D9C8CB841ULL,   986,  316 },
+    { 0x9E19DB92B4E31BA9ULL,  1013,  324 }
+};
+#endif
+
 /*** STRING local functions ***/
 
 /*******************************************************************/
@@ -56,260 +289,1017 @@ errors:
 }
 
 /*******************************************************************/
-static STRING_status_t _STRING_decimal_digit_to_char(uint8_t value, char_t* chr) {
+#define _STRING_is_word_aligned(ptr) ((((__UINTPTR_TYPE__) (ptr)) & (sizeof(STRING_word_t) - 1)) == 0)
+
+/*******************************************************************/
+#define _STRING_word_has_null(word) ((((word) - 0x01010101UL) & (~(word)) & 0x80808080UL) != 0)
+
+/*******************************************************************/
+#define _STRING_word_broadcast(chr) (((STRING_word_t) ((uint8_t) (chr))) * 0x01010101UL)
+
+/*******************************************************************/
+#define _STRING_bitmap_set(bitmap, chr) { (bitmap)[((uint8_t) (chr)) >> 5] |= (0b1UL << (((uint8_t) (chr)) & 0x1F)); }
+
+/*******************************************************************/
+#define _STRING_bitmap_get(bitmap, chr) (((bitmap)[((uint8_t) (chr)) >> 5] >> (((uint8_t) (chr)) & 0x1F)) & 0b1)
+
+/*******************************************************************/
+#define _STRING_hexadecimal_char_to_value(chr) ((((uint8_t) ((chr) - '0')) < STRING_HEXADECIMAL_VALUE_TABLE_SIZE) ? STRING_HEXADECIMAL_VALUE[(uint8_t) ((chr) - '0')] : STRING_HEXADECIMAL_VALUE_INVALID)
+
+/*******************************************************************/
+#define _STRING_write_hexadecimal_byte(byte, str) { \
+    (str)[0] = STRING_HEXADECIMAL_CHAR[((byte) >> 4) & 0x0F]; \
+    (str)[1] = STRING_HEXADECIMAL_CHAR[(byte) & 0x0F]; \
+}
+
+/*******************************************************************/
+static void _STRING_write_hexadecimal_bytes(uint8_t* data, uint32_t data_size_bytes, char_t* str) {
+    // Local variables.
+    STRING_word_t nibbles = 0;
+    STRING_word_t letters = 0;
+    uint32_t pair = 0;
+    uint32_t idx = 0;
+    // Single bytes until the destination is word aligned.
+    while ((idx < data_size_bytes) && (_STRING_is_word_aligned(&(str[idx << 1])) == 0)) {
+        _STRING_write_hexadecimal_byte(data[idx], &(str[idx << 1]));
+        idx++;
+    }
+    // Two bytes per word: each nibble is moved to its own byte and converted to a character.
+    while ((data_size_bytes - idx) >= 2) {
+#if (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+        pair = ((((uint32_t) data[idx]) << 16) | data[idx + 1]);
+        nibbles = (((pair << 4) & 0x0F000F00UL) | (pair & 0x000F000FUL));
+#else
+        pair = (((uint32_t) data[idx]) | (((uint32_t) data[idx + 1]) << 16));
+        nibbles = (((pair >> 4) & 0x000F000FUL) | ((pair << 8) & 0x0F000F00UL));
+#endif
+        letters = (((nibbles + _STRING_word_broadcast(0x06)) >> 4) & 0x01010101UL);
+        (*((STRING_word_t*) &(str[idx << 1]))) = (nibbles + _STRING_word_broadcast('0') + (letters * STRING_HEXADECIMAL_LETTER_OFFSET));
+        idx += 2;
+    }
+    // Last byte.
+    if (idx < data_size_bytes) {
+        _STRING_write_hexadecimal_byte(data[idx], &(str[idx << 1]));
+    }
+}
+
+/*******************************************************************/
+static uint8_t __attribute__((no_sanitize_address)) _STRING_hexadecimal_word_to_bytes(char_t* str, uint8_t* data) {
+    // Local variables.
+    // The word is read from an aligned address so it never crosses a memory protection boundary, even if the string ends within it.
+    STRING_word_t word = (*((STRING_word_t*) str));
+    STRING_word_t lower_case = (word | _STRING_word_broadcast(0x20));
+    STRING_word_t digits = 0;
+    STRING_word_t letters = 0;
+    STRING_word_t values = 0;
+    uint8_t valid_flag = 0;
+    // Bounds are checked by adding (0x80 - bound) to each character: bit 7 is set when the character is greater or equal (ASCII only).
+    if ((word & 0x80808080UL) != 0) goto end;
+    digits = ((word + _STRING_word_broadcast(0x80 - '0')) & (~(word + _STRING_word_broadcast(0x80 - '9' - 1))) & 0x80808080UL);
+    letters = ((lower_case + _STRING_word_broadcast(0x80 - 'a')) & (~(lower_case + _STRING_word_broadcast(0x80 - 'f' - 1))) & 0x80808080UL);
+    if ((digits | letters) != 0x80808080UL) goto end;
+    // Value is the low nibble of the character, plus 9 for letters.
+    values = ((word & 0x0F0F0F0FUL) + ((letters >> 7) * 9));
+#if (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+    values = (((values & 0x0F000F00UL) >> 4) | (values & 0x000F000FUL));
+    data[0] = (uint8_t) (values >> 16);
+    data[1] = (uint8_t) (values);
+#else
+    values = (((values & 0x000F000FUL) << 4) | ((values >> 8) & 0x000F000FUL));
+    data[0] = (uint8_t) (values);
+    data[1] = (uint8_t) (values >> 16);
+#endif
+    valid_flag = 1;
+end:
+    return valid_flag;
+}
+
+/*******************************************************************/
+#define _STRING_base64_char_to_value(chr) ((((uint8_t) ((chr) - '+')) < STRING_BASE64_VALUE_TABLE_SIZE) ? STRING_BASE64_VALUE[(uint8_t) ((chr) - '+')] : STRING_BASE64_VALUE_INVALID)
+
+/*******************************************************************/
+#define _STRING_write_base64_quartet(triplet, str) { \
+    (str)[0] = STRING_BASE64_CHAR[((triplet) >> 18) & 0x3F]; \
+    (str)[1] = STRING_BASE64_CHAR[((triplet) >> 12) & 0x3F]; \
+    (str)[2] = STRING_BASE64_CHAR[((triplet) >> 6) & 0x3F]; \
+    (str)[3] = STRING_BASE64_CHAR[(triplet) & 0x3F]; \
+}
+
+/*******************************************************************/
+static STRING_status_t _STRING_hexadecimal_char_to_digit(char_t chr, uint8_t* value) {
     // Local variables.
     STRING_status_t status = STRING_SUCCESS;
-    // Check parameters.
-    if (value > MATH_DECIMAL_DIGIT_VALUE_MAX) {
-        status = STRING_ERROR_DECIMAL_OVERFLOW;
+    uint8_t digit = _STRING_hexadecimal_char_to_value(chr);
+    // Check character.
+    if (digit == STRING_HEXADECIMAL_VALUE_INVALID) {
+        status = STRING_ERROR_HEXADECIMAL_INVALID;
         goto errors;
     }
-    // Perform conversion.
-    (*chr) = (char_t) (value + '0');
+    (*value) = digit;
 errors:
     return status;
 }
 
 /*******************************************************************/
-static STRING_status_t _STRING_is_hexadecimal_char(char_t chr) {
+static uint8_t _STRING_get_number_of_decimal_digits(uint32_t value) {
     // Local variables.
-    STRING_status_t status = (((chr >= '0') && (chr <= '9')) || ((chr >= 'A') && (chr <= 'F')) || ((chr >= 'a') && (chr <= 'f'))) ? STRING_SUCCESS : STRING_ERROR_HEXADECIMAL_INVALID;
-    return status;
+    uint8_t number_of_digits = 0;
+    // Comparison tree (at most 4 comparisons).
+    if (value < 100000) {
+        if (value < 100) {
+            number_of_digits = (value < 10) ? 1 : 2;
+        }
+        else if (value < 10000) {
+            number_of_digits = (value < 1000) ? 3 : 4;
+        }
+        else {
+            number_of_digits = 5;
+        }
+    }
+    else if (value < 10000000) {
+        number_of_digits = (value < 1000000) ? 6 : 7;
+    }
+    else if (value < 1000000000) {
+        number_of_digits = (value < 100000000) ? 8 : 9;
+    }
+    else {
+        number_of_digits = 10;
+    }
+    return number_of_digits;
 }
 
 /*******************************************************************/
-static STRING_status_t _STRING_hexadecimal_char_to_digit(char_t chr, uint8_t* value) {
+static void _STRING_write_decimal_digits(uint32_t value, uint8_t number_of_digits, char_t* str) {
     // Local variables.
-    STRING_status_t status = STRING_ERROR_HEXADECIMAL_INVALID;
-    // Check ranges.
-    if ((chr >= 'A') && (chr <= 'F')) {
-        (*value) = (chr - 'A' + 10) & 0x0F;
-        status = STRING_SUCCESS;
+    uint32_t quotient = 0;
+    uint32_t pair_idx = 0;
+    uint8_t str_idx = number_of_digits;
+    // Digits are written from the end, two at a time.
+    while (value >= 100) {
+        quotient = (uint32_t) ((((uint64_t) value) * STRING_DIVIDE_BY_100_MULTIPLIER) >> STRING_DIVIDE_BY_100_SHIFT);
+        pair_idx = ((value - (quotient * 100)) << 1);
+        str[--str_idx] = STRING_DECIMAL_DIGIT_PAIRS[pair_idx + 1];
+        str[--str_idx] = STRING_DECIMAL_DIGIT_PAIRS[pair_idx];
+        value = quotient;
     }
-    if ((chr >= 'a') && (chr <= 'f')) {
-        (*value) = (chr - 'a' + 10) & 0x0F;
-        status = STRING_SUCCESS;
+    // Last one or two digits.
+    if (value >= 10) {
+        pair_idx = (value << 1);
+        str[--str_idx] = STRING_DECIMAL_DIGIT_PAIRS[pair_idx + 1];
+        str[--str_idx] = STRING_DECIMAL_DIGIT_PAIRS[pair_idx];
     }
-    if ((chr >= '0') && (chr <= '9')) {
-        (*value) = (chr - '0') & 0x0F;
-        status = STRING_SUCCESS;
+    else {
+        str[--str_idx] = (char_t) (value + '0');
+    }
+    // Zero padding.
+    while (str_idx > 0) {
+        str[--str_idx] = '0';
     }
-    return status;
 }
 
 /*******************************************************************/
-static STRING_status_t _STRING_hexadecimal_digit_to_char(uint8_t value, char_t* chr) {
+static uint8_t _STRING_uint32_to_decimal_string(uint32_t value, char_t* str) {
     // Local variables.
-    STRING_status_t status = STRING_SUCCESS;
-    // Check parameters.
-    if (value > MATH_HEXADECIMAL_DIGIT_VALUE_MAX) {
-        status = STRING_ERROR_HEXADECIMAL_OVERFLOW;
-        goto errors;
-    }
-    // Perform conversion.
-    (*chr) = (char_t) (value <= 9 ? (value + '0') : (value + (STRING_HEXADECIMAL_LETTER_START - 10)));
-errors:
-    return status;
+    uint8_t number_of_digits = _STRING_get_number_of_decimal_digits(value);
+    // Convert without leading zero.
+    _STRING_write_decimal_digits(value, number_of_digits, str);
+    return number_of_digits;
 }
 
 /*******************************************************************/
-static uint8_t _STRING_get_number_of_decimal_digits(uint32_t value) {
+static uint8_t _STRING_uint64_to_decimal_string(uint64_t value, char_t* str) {
     // Local variables.
+    uint32_t chunks[STRING_U64_DECIMAL_CHUNKS_MAX];
+    uint64_t quotient = 0;
+    uint8_t number_of_chunks = 0;
     uint8_t number_of_digits = 0;
-    // Power loop.
-    for (number_of_digits = 0; number_of_digits < MATH_S32_SIZE_DECIMAL_DIGITS; number_of_digits++) {
-        if (value < MATH_POWER_10[number_of_digits]) break;
+    // Split value in chunks which can be converted with 32-bits arithmetic.
+    while (value > MATH_U32_MAX) {
+        quotient = (value / STRING_DECIMAL_CHUNK_DIVIDER);
+        chunks[number_of_chunks++] = (uint32_t) (value - (quotient * STRING_DECIMAL_CHUNK_DIVIDER));
+        value = quotient;
+    }
+    // Most significant part is printed without leading zero.
+    number_of_digits = _STRING_uint32_to_decimal_string((uint32_t) value, str);
+    // Other chunks are zero padded.
+    while (number_of_chunks > 0) {
+        number_of_chunks--;
+        _STRING_write_decimal_digits(chunks[number_of_chunks], STRING_DECIMAL_CHUNK_SIZE_DIGITS, &(str[number_of_digits]));
+        number_of_digits += STRING_DECIMAL_CHUNK_SIZE_DIGITS;
     }
-    return ((number_of_digits == 0) ? 1 : number_of_digits);
+    return number_of_digits;
 }
 
+#if (EMBEDDED_UTILS_MATH_PRECISION > 0)
 /*******************************************************************/
-static STRING_status_t _STRING_extract_decimal_digits(uint32_t value, char_t* digit_array) {
+static STRING_diy_fp_t _STRING_diy_fp_normalize(STRING_diy_fp_t x) {
+    // Shift until most significant bit is set.
+    while ((x.f & 0x8000000000000000ULL) == 0) {
+        x.f <<= 1;
+        x.e--;
+    }
+    return x;
+}
+
+/*******************************************************************/
+static STRING_diy_fp_t _STRING_diy_fp_multiply(STRING_diy_fp_t x, STRING_diy_fp_t y) {
     // Local variables.
-    STRING_status_t status = STRING_SUCCESS;
-    uint32_t previous_decade = 0;
-    uint8_t digit = 0;
-    uint8_t digit_array_index = 0;
-    uint8_t first_non_zero_found = 0;
-    int32_t idx = 0;
-    // Digits loop.
-    for (idx = (MATH_U32_SIZE_DECIMAL_DIGITS - 1); idx >= 0; idx--) {
-        digit = (uint8_t) ((value - previous_decade) / (MATH_POWER_10[idx]));
-        previous_decade += (digit * MATH_POWER_10[idx]);
-        if (digit != 0) {
-            first_non_zero_found = 1;
-        }
-        if ((first_non_zero_found != 0) || (idx == 0)) {
-            status = _STRING_decimal_digit_to_char(digit, &(digit_array[digit_array_index++]));
-            if (status != STRING_SUCCESS) goto errors;
-        }
+    STRING_diy_fp_t result;
+    uint64_t x_lo = (x.f & MATH_U32_MAX);
+    uint64_t x_hi = (x.f >> 32);
+    uint64_t y_lo = (y.f & MATH_U32_MAX);
+    uint64_t y_hi = (y.f >> 32);
+    uint64_t p0 = (x_lo * y_lo);
+    uint64_t p1 = (x_lo * y_hi);
+    uint64_t p2 = (x_hi * y_lo);
+    uint64_t p3 = (x_hi * y_hi);
+    uint64_t middle = 0;
+    // Upper 64 bits of the 128-bits product, rounded.
+    middle = (p0 >> 32) + (p1 & MATH_U32_MAX) + (p2 & MATH_U32_MAX) + (1ULL << 31);
+    result.f = p3 + (p1 >> 32) + (p2 >> 32) + (middle >> 32);
+    result.e = x.e + y.e + 64;
+    return result;
+}
+
+/*******************************************************************/
+static void _STRING_grisu2_round(char_t* digits, uint8_t number_of_digits, uint64_t distance, uint64_t delta, uint64_t rest, uint64_t ten_kappa) {
+    // Move last digit closer to the exact value while staying within the rounding interval.
+    while ((rest < distance) && ((delta - rest) >= ten_kappa) && (((rest + ten_kappa) < distance) || ((distance - rest) > (rest + ten_kappa - distance)))) {
+        digits[number_of_digits - 1]--;
+        rest += ten_kappa;
     }
-errors:
-    return status;
 }
 
-/*** STRING functions ***/
+/*******************************************************************/
+static void _STRING_grisu2(STRING_diy_fp_t value, uint8_t lower_boundary_closer, char_t* digits, uint8_t* number_of_digits, int32_t* decimal_exponent) {
+    // Local variables.
+    const STRING_cached_power_t* cached = NULL;
+    STRING_diy_fp_t m_plus;
+    STRING_diy_fp_t m_minus;
+    STRING_diy_fp_t c_minus_k;
+    STRING_diy_fp_t w;
+    STRING_diy_fp_t w_plus;
+    STRING_diy_fp_t w_minus;
+    uint64_t delta = 0;
+    uint64_t distance = 0;
+    uint64_t one = 0;
+    uint64_t p2 = 0;
+    uint64_t rest = 0;
+    uint32_t p1 = 0;
+    uint32_t power_10 = 0;
+    int32_t one_e = 0;
+    int32_t k = 0;
+    uint8_t n = 0;
+    // Compute boundaries of the rounding interval (half way to the neighbours).
+    m_plus.f = ((value.f << 1) + 1);
+    m_plus.e = (value.e - 1);
+    if (lower_boundary_closer != 0) {
+        m_minus.f = ((value.f << 2) - 1);
+        m_minus.e = (value.e - 2);
+    }
+    else {
+        m_minus.f = ((value.f << 1) - 1);
+        m_minus.e = (value.e - 1);
+    }
+    m_plus = _STRING_diy_fp_normalize(m_plus);
+    m_minus.f <<= (m_minus.e - m_plus.e);
+    m_minus.e = m_plus.e;
+    value = _STRING_diy_fp_normalize(value);
+    // Select the cached power which brings the upper boundary exponent in the [alpha, gamma] range.
+    k = (STRING_GRISU_ALPHA - m_plus.e - 1);
+    k = ((k * 78913) / (1 << 18)) + ((k > 0) ? 1 : 0);
+    cached = &(STRING_CACHED_POWERS[(k - STRING_CACHED_POWERS_EXPONENT_MIN + STRING_CACHED_POWERS_EXPONENT_STEP - 1) / STRING_CACHED_POWERS_EXPONENT_STEP]);
+    c_minus_k.f = (cached->f);
+    c_minus_k.e = (cached->e);
+    (*decimal_exponent) = -(cached->k);
+    // Scale value and boundaries.
+    w = _STRING_diy_fp_multiply(value, c_minus_k);
+    w_minus = _STRING_diy_fp_multiply(m_minus, c_minus_k);
+    w_plus = _STRING_diy_fp_multiply(m_plus, c_minus_k);
+    // Remove the multiplication error from the interval.
+    w_minus.f++;
+    w_plus.f--;
+    delta = (w_plus.f - w_minus.f);
+    distance = (w_plus.f - w.f);
+    // Split upper boundary in integral and fractional parts.
+    one_e = -(w_plus.e);
+    one = (1ULL << one_e);
+    p1 = (uint32_t) (w_plus.f >> one_e);
+    p2 = (w_plus.f & (one - 1));
+    (*number_of_digits) = 0;
+    // Generate integral digits.
+    n = _STRING_get_number_of_decimal_digits(p1);
+    power_10 = MATH_POWER_10[n - 1];
+    while (n > 0) {
+        digits[(*number_of_digits)++] = (char_t) ((p1 / power_10) + '0');
+        p1 %= power_10;
+        n--;
+        rest = ((((uint64_t) p1) << one_e) + p2);
+        if (rest <= delta) {
+            // Enough digits to be within the rounding interval.
+            (*decimal_exponent) += n;
+            _STRING_grisu2_round(digits, (*number_of_digits), distance, delta, rest, (((uint64_t) power_10) << one_e));
+            goto end;
+        }
+        power_10 /= 10;
+    }
+    // Generate fractional digits.
+    do {
+        p2 *= 10;
+        digits[(*number_of_digits)++] = (char_t) ((p2 >> one_e) + '0');
+        p2 &= (one - 1);
+        delta *= 10;
+        distance *= 10;
+        (*decimal_exponent)--;
+    }
+    while (p2 > delta);
+    _STRING_grisu2_round(digits, (*number_of_digits), distance, delta, p2, one);
+end:
+    return;
+}
 
 /*******************************************************************/
-STRING_status_t STRING_integer_to_string(int32_t value, STRING_format_t format, uint8_t print_prefix, char_t* str) {
+static STRING_status_t _STRING_format_floating(char_t* digits, uint8_t number_of_digits, int32_t decimal_exponent, uint8_t negative_flag, char_t* str) {
     // Local variables.
     STRING_status_t status = STRING_SUCCESS;
-    uint8_t first_non_zero_found = 0;
-    uint32_t str_idx = 0;
-    uint8_t generic_byte = 0;
-    uint32_t previous_decade = 0;
-    uint32_t abs_value = 0;
+    int32_t point_position = (((int32_t) number_of_digits) + decimal_exponent);
     int32_t idx = 0;
-    // Check parameters.
-    _STRING_check_pointer(str);
-    // Manage negative numbers.
-    if (value < 0) {
+    uint8_t str_idx = 0;
+    // Sign.
+    if (negative_flag != 0) {
         str[str_idx++] = STRING_CHAR_MINUS;
     }
-    // Get absolute value.
-    MATH_abs(value, abs_value, uint32_t);
-    // Build string according to format.
-    switch (format) {
-    case STRING_FORMAT_BOOLEAN:
-        if (print_prefix != 0) {
-            // Print "0b" prefix.
-            str[str_idx++] = '0';
-            str[str_idx++] = 'b';
+    if ((point_position >= number_of_digits) && (point_position <= STRING_FLOATING_PLAIN_POSITION_MAX)) {
+        // Integer value: digits followed by zeros.
+        for (idx = 0; idx < point_position; idx++) {
+            str[str_idx++] = (idx < number_of_digits) ? digits[idx] : '0';
         }
-        for (idx = (MATH_S32_SIZE_BITS - 1); idx >= 0; idx--) {
-            if (abs_value & (0b1 << idx)) {
-                str[str_idx++] = '1';
-                first_non_zero_found = 1;
-            }
-            else {
-                if ((first_non_zero_found != 0) || (idx == 0)) {
-                    str[str_idx++] = '0';
-                }
+    }
+    else if ((point_position > 0) && (point_position <= STRING_FLOATING_PLAIN_POSITION_MAX)) {
+        // Decimal point within digits.
+        for (idx = 0; idx < number_of_digits; idx++) {
+            if (idx == point_position) {
+                str[str_idx++] = STRING_CHAR_DOT;
             }
+            str[str_idx++] = digits[idx];
         }
-        break;
-    case STRING_FORMAT_HEXADECIMAL:
-        if (print_prefix != 0) {
-            // Print "0x" prefix.
+    }
+    else if ((point_position <= 0) && (point_position >= STRING_FLOATING_PLAIN_POSITION_MIN)) {
+        // Decimal point before digits.
+        str[str_idx++] = '0';
+        str[str_idx++] = STRING_CHAR_DOT;
+        for (idx = point_position; idx < 0; idx++) {
             str[str_idx++] = '0';
-            str[str_idx++] = 'x';
         }
-        for (idx = ((MATH_S32_SIZE_HEXADECIMAL_DIGITS >> 1) - 1); idx >= 0; idx--) {
-            generic_byte = (abs_value >> (idx << 3)) & MATH_U8_MASK;
-            if (generic_byte != 0) {
-                first_non_zero_found = 1;
-            }
-            if ((first_non_zero_found != 0) || (idx == 0)) {
-                // Convert to character.
-                status = _STRING_hexadecimal_digit_to_char(((generic_byte & 0xF0) >> 4), &(str[str_idx++]));
-                if (status != STRING_SUCCESS) goto errors;
-                status = _STRING_hexadecimal_digit_to_char(((generic_byte & 0x0F) >> 0), &(str[str_idx++]));
-                if (status != STRING_SUCCESS) goto errors;
+        for (idx = 0; idx < number_of_digits; idx++) {
+            str[str_idx++] = digits[idx];
+        }
+    }
+    else {
+        // Scientific notation.
+        str[str_idx++] = digits[0];
+        if (number_of_digits > 1) {
+            str[str_idx++] = STRING_CHAR_DOT;
+            for (idx = 1; idx < number_of_digits; idx++) {
+                str[str_idx++] = digits[idx];
             }
         }
-        break;
-    case STRING_FORMAT_DECIMAL:
-        if (print_prefix != 0) {
-            // Print "0d" prefix.
-            str[str_idx++] = '0';
-            str[str_idx++] = 'd';
+        str[str_idx++] = 'e';
+        point_position--;
+        if (point_position < 0) {
+            str[str_idx++] = STRING_CHAR_MINUS;
+            point_position = -point_position;
         }
-        for (idx = (MATH_S32_SIZE_DECIMAL_DIGITS - 1); idx >= 0; idx--) {
-            generic_byte = (uint8_t) ((abs_value - previous_decade) / (MATH_POWER_10[idx]));
-            previous_decade += (generic_byte * MATH_POWER_10[idx]);
-            if (generic_byte != 0) {
-                first_non_zero_found = 1;
+        str_idx += _STRING_uint32_to_decimal_string((uint32_t) point_position, &(str[str_idx]));
+    }
+    str[str_idx] = STRING_CHAR_NULL;
+    return status;
+}
+
+/*******************************************************************/
+static void _STRING_bignum_multiply(STRING_bignum_t* x, uint32_t factor) {
+    // Local variables.
+    uint64_t product = 0;
+    uint8_t idx = 0;
+    // Multiply all words and propagate carry.
+    for (idx = 0; idx < STRING_BIGNUM_SIZE_WORDS; idx++) {
+        product += (((uint64_t) (x->words[idx])) * factor);
+        (x->words[idx]) = (uint32_t) product;
+        product >>= 32;
+    }
+}
+
+/*******************************************************************/
+static uint32_t _STRING_bignum_divide(STRING_bignum_t* x, uint32_t divider) {
+    // Local variables.
+    uint64_t remainder = 0;
+    uint8_t idx = STRING_BIGNUM_SIZE_WORDS;
+    // Divide from the most significant word.
+    while (idx > 0) {
+        idx--;
+        remainder = ((remainder << 32) | (x->words[idx]));
+        (x->words[idx]) = (uint32_t) (remainder / divider);
+        remainder %= divider;
+    }
+    return ((uint32_t) remainder);
+}
+
+/*******************************************************************/
+static void _STRING_bignum_shift_left(STRING_bignum_t* x, uint32_t shift) {
+    // Local variables.
+    uint32_t word_shift = (shift >> 5);
+    uint32_t bit_shift = (shift & 0x1F);
+    uint32_t word = 0;
+    uint8_t idx = STRING_BIGNUM_SIZE_WORDS;
+    // Caller guarantees that no significant bit is shifted out.
+    while (idx > 0) {
+        idx--;
+        word = 0;
+        if (idx >= word_shift) {
+            word = ((x->words[idx - word_shift]) << bit_shift);
+            if ((bit_shift != 0) && (idx > word_shift)) {
+                word |= ((x->words[idx - word_shift - 1]) >> (32 - bit_shift));
             }
-            if ((first_non_zero_found != 0) || (idx == 0)) {
-                status = _STRING_decimal_digit_to_char(generic_byte, &(str[str_idx++]));
-                if (status != STRING_SUCCESS) goto errors;
+        }
+        (x->words[idx]) = word;
+    }
+}
+
+/*******************************************************************/
+static void _STRING_bignum_shift_right_round(STRING_bignum_t* x, uint32_t shift) {
+    // Local variables.
+    uint32_t word_shift = (shift >> 5);
+    uint32_t bit_shift = (shift & 0x1F);
+    uint32_t half_position = (shift - 1);
+    uint32_t word = 0;
+    uint8_t half_flag = 0;
+    uint8_t sticky_flag = 0;
+    uint8_t idx = 0;
+    // Value is lower than one half of the result unit.
+    if (shift > STRING_BIGNUM_SIZE_BITS) {
+        for (idx = 0; idx < STRING_BIGNUM_SIZE_WORDS; idx++) {
+            (x->words[idx]) = 0;
+        }
+        goto end;
+    }
+    // Get the first bit shifted out and check if any following bit is set.
+    half_flag = (uint8_t) (((x->words[half_position >> 5]) >> (half_position & 0x1F)) & 0x01);
+    sticky_flag = (((x->words[half_position >> 5]) & ((1UL << (half_position & 0x1F)) - 1)) != 0) ? 1 : 0;
+    for (idx = 0; idx < (half_position >> 5); idx++) {
+        sticky_flag |= ((x->words[idx]) != 0) ? 1 : 0;
+    }
+    // Shift.
+    for (idx = 0; idx < STRING_BIGNUM_SIZE_WORDS; idx++) {
+        word = 0;
+        if ((idx + word_shift) < STRING_BIGNUM_SIZE_WORDS) {
+            word = ((x->words[idx + word_shift]) >> bit_shift);
+            if ((bit_shift != 0) && ((idx + word_shift + 1) < STRING_BIGNUM_SIZE_WORDS)) {
+                word |= ((x->words[idx + word_shift + 1]) << (32 - bit_shift));
             }
         }
-        break;
-    default:
-        status = STRING_ERROR_FORMAT;
-        goto errors;
+        (x->words[idx]) = word;
     }
-errors:
-    str[str_idx++] = STRING_CHAR_NULL; // End string.
-    return status;
+    // Round half to even, as the standard printf function does.
+    if ((half_flag != 0) && ((sticky_flag != 0) || (((x->words[0]) & 0x01) != 0))) {
+        idx = 0;
+        do {
+            (x->words[idx])++;
+        }
+        while (((x->words[idx++]) == 0) && (idx < STRING_BIGNUM_SIZE_WORDS));
+    }
+end:
+    return;
 }
 
 /*******************************************************************/
-STRING_status_t STRING_integer_to_floating_decimal_string(int32_t value, uint8_t divider_exponent, uint8_t number_of_digits, char_t* str) {
+static STRING_status_t _STRING_format_floating_fixed(STRING_diy_fp_t value, uint8_t negative_flag, uint8_t number_of_decimals, char_t* str) {
     // Local variables.
     STRING_status_t status = STRING_SUCCESS;
-    char_t digit_array[MATH_U32_SIZE_DECIMAL_DIGITS];
-    uint8_t number_of_effective_digits = number_of_digits;
-    uint32_t value_abs = 0;
-    uint8_t value_size_digits = 0;
-    uint32_t integer_part = 0;
-    uint8_t integer_part_size_digits = 0;
-    uint8_t number_of_left_zero = 0;
-    uint8_t left_zero_count = 0;
+    STRING_bignum_t scaled;
+    char_t digits[STRING_FLOATING_FIXED_DIGITS_MAX];
+    uint8_t first_digit_idx = STRING_FLOATING_FIXED_DIGITS_MAX;
+    uint8_t decimals_left = number_of_decimals;
+    uint8_t power = 0;
     uint8_t str_idx = 0;
-    uint8_t digit_idx = 0;
-    uint8_t char_idx = 0;
-    // Init digit array.
-    for (char_idx = 0; char_idx < MATH_U32_SIZE_DECIMAL_DIGITS; char_idx++) {
-        digit_array[char_idx] = '0';
+    uint8_t idx = 0;
+    // Sign.
+    if (negative_flag != 0) {
+        str[str_idx++] = STRING_CHAR_MINUS;
     }
-    char_idx = 0;
-    // Check parameters.
-    if (number_of_digits == 0) {
-        status = STRING_ERROR_NUMBER_OF_DIGITS_UNDERFLOW;
+    // Check range.
+    if (value.e > STRING_FLOATING_FIXED_EXPONENT_MAX) {
+        status = STRING_ERROR_DECIMAL_OVERFLOW;
         goto errors;
     }
-    if ((divider_exponent >= MATH_U32_SIZE_DECIMAL_DIGITS) || (number_of_digits > MATH_U32_SIZE_DECIMAL_DIGITS)) {
+    // Compute the exact value scaled by 10^decimals.
+    scaled.words[0] = (uint32_t) (value.f);
+    scaled.words[1] = (uint32_t) ((value.f) >> 32);
+    for (idx = 2; idx < STRING_BIGNUM_SIZE_WORDS; idx++) {
+        scaled.words[idx] = 0;
+    }
+    while (decimals_left > 0) {
+        power = (decimals_left > STRING_DECIMAL_CHUNK_SIZE_DIGITS) ? STRING_DECIMAL_CHUNK_SIZE_DIGITS : decimals_left;
+        _STRING_bignum_multiply(&scaled, MATH_POWER_10[power]);
+        decimals_left -= power;
+    }
+    // Apply binary exponent, the last digit is correctly rounded from the bits shifted out.
+    if (value.e >= 0) {
+        _STRING_bignum_shift_left(&scaled, (uint32_t) value.e);
+    }
+    else {
+        _STRING_bignum_shift_right_round(&scaled, (uint32_t) (-value.e));
+    }
+    // Convert to decimal digits by chunks.
+    idx = STRING_FLOATING_FIXED_DIGITS_MAX;
+    while (idx > 0) {
+        idx -= STRING_DECIMAL_CHUNK_SIZE_DIGITS;
+        _STRING_write_decimal_digits(_STRING_bignum_divide(&scaled, STRING_DECIMAL_CHUNK_DIVIDER), STRING_DECIMAL_CHUNK_SIZE_DIGITS, &(digits[idx]));
+    }
+    // Skip leading zeros but keep at least one integer digit.
+    for (idx = 0; idx < (STRING_FLOATING_FIXED_DIGITS_MAX - number_of_decimals - 1); idx++) {
+        if (digits[idx] != '0') break;
+    }
+    first_digit_idx = idx;
+    if ((STRING_FLOATING_FIXED_DIGITS_MAX - number_of_decimals - first_digit_idx) > STRING_FLOATING_PLAIN_POSITION_MAX) {
         status = STRING_ERROR_DECIMAL_OVERFLOW;
         goto errors;
     }
-    if (str == NULL) {
-        status = STRING_ERROR_NULL_PARAMETER;
-        goto errors;
+    // Integer part.
+    for (idx = first_digit_idx; idx < (STRING_FLOATING_FIXED_DIGITS_MAX - number_of_decimals); idx++) {
+        str[str_idx++] = digits[idx];
     }
-    // Check sign.
-    if (value < 0) {
-        str[str_idx++] = STRING_CHAR_MINUS;
-        number_of_effective_digits--;
+    // Decimal part.
+    if (number_of_decimals > 0) {
+        str[str_idx++] = STRING_CHAR_DOT;
+        for (; idx < STRING_FLOATING_FIXED_DIGITS_MAX; idx++) {
+            str[str_idx++] = digits[idx];
+        }
     }
-    if (number_of_effective_digits == 0) {
-        status = STRING_ERROR_NUMBER_OF_DIGITS_UNDERFLOW;
+errors:
+    str[str_idx] = STRING_CHAR_NULL;
+    return status;
+}
+
+/*******************************************************************/
+static STRING_status_t _STRING_floating_to_string(uint64_t bits, uint8_t significand_size_bits, uint8_t exponent_size_bits, uint8_t number_of_decimals, char_t* str) {
+    // Local variables.
+    STRING_status_t status = STRING_SUCCESS;
+    char_t digits[STRING_FLOATING_DIGITS_MAX];
+    STRING_diy_fp_t value;
+    uint64_t significand = (bits & ((1ULL << significand_size_bits) - 1));
+    uint32_t exponent = (uint32_t) ((bits >> significand_size_bits) & ((1UL << exponent_size_bits) - 1));
+    uint32_t exponent_max = ((1UL << exponent_size_bits) - 1);
+    int32_t bias = (int32_t) ((1UL << (exponent_size_bits - 1)) - 1);
+    uint8_t negative_flag = (uint8_t) ((bits >> (significand_size_bits + exponent_size_bits)) & 0x01);
+    uint8_t number_of_digits = 0;
+    int32_t decimal_exponent = 0;
+    char_t* special = NULL;
+    uint8_t idx = 0;
+    // Check parameters.
+    _STRING_check_pointer(str);
+    if ((number_of_decimals > STRING_FLOATING_DECIMALS_MAX) && (number_of_decimals != STRING_FLOATING_DECIMALS_SHORTEST)) {
+        status = STRING_ERROR_NUMBER_OF_DIGITS_OVERFLOW;
         goto errors;
     }
-    // Compute integer part.
-    MATH_abs(value, value_abs, uint32_t);
-    value_size_digits = _STRING_get_number_of_decimal_digits(value_abs);
-    integer_part = (value_abs / MATH_POWER_10[divider_exponent]);
-    integer_part_size_digits = _STRING_get_number_of_decimal_digits(integer_part);
-    // Check range.
-    if (integer_part_size_digits > number_of_effective_digits) {
-        status = STRING_ERROR_NUMBER_OF_DIGITS_OVERFLOW;
+    // Infinity or not a number.
+    if (exponent == exponent_max) {
+        special = (significand != 0) ? "nan" : ((negative_flag != 0) ? "-inf" : "inf");
+        idx = 0;
+        do {
+            str[idx] = special[idx];
+        }
+        while (special[idx++] != STRING_CHAR_NULL);
         goto errors;
     }
-    // Extract digits.
-    status = _STRING_extract_decimal_digits(value_abs, (char_t*) digit_array);
-    if (status != STRING_SUCCESS) goto errors;
-    // Compute number of left padding zero.
-    if (divider_exponent >= value_size_digits) {
-        number_of_left_zero = (uint8_t) (divider_exponent - value_size_digits + 1);
+    // Decode value.
+    if (exponent == 0) {
+        // Zero or subnormal value.
+        value.f = significand;
+        value.e = (1 - bias - significand_size_bits);
     }
-    // Digits loop.
-    while (str_idx < number_of_digits) {
-        // Compute digit.
-        if (char_idx == integer_part_size_digits) {
-            // Check if there is enough space for a decimal part.
-            if ((number_of_effective_digits - char_idx) < 2) break;
-            // Insert dot.
-            str[str_idx++] = STRING_CHAR_DOT;
-        }
-        else {
-            // Left padding.
-            if (left_zero_count < number_of_left_zero) {
-                str[str_idx++] = '0';
-                left_zero_count++;
-            }
-            else {
+    else {
+        value.f = (significand | (1ULL << significand_size_bits));
+        value.e = ((int32_t) exponent - bias - significand_size_bits);
+    }
+    // Fixed number of decimals.
+    if (number_of_decimals != STRING_FLOATING_DECIMALS_SHORTEST) {
+        status = _STRING_format_floating_fixed(value, negative_flag, number_of_decimals, str);
+        goto errors;
+    }
+    // Compute short digits (Grisu2 may give one more digit than the shortest representation).
+    if (value.f == 0) {
+        digits[0] = '0';
+        number_of_digits = 1;
+    }
+    else {
+        // Lower neighbour is closer when the value is a power of 2.
+        _STRING_grisu2(value, (((significand == 0) && (exponent > 1)) ? 1 : 0), digits, &number_of_digits, &decimal_exponent);
+    }
+    status = _STRING_format_floating(digits, number_of_digits, decimal_exponent, negative_flag, str);
+errors:
+    return status;
+}
+#endif
+
+/*******************************************************************/
+static STRING_status_t _STRING_extract_decimal_digits(uint32_t value, char_t* digit_array) {
+    // Local variables.
+    STRING_status_t status = STRING_SUCCESS;
+    // Convert without leading zero.
+    _STRING_uint32_to_decimal_string(value, digit_array);
+    return status;
+}
+
+/*******************************************************************/
+static STRING_status_t _STRING_append_char(char_t* str, uint32_t str_size_max, char_t chr, uint32_t* str_size) {
+    // Local variables.
+    STRING_status_t status = STRING_SUCCESS;
+    // Check index.
+    if ((*str_size) >= str_size_max) {
+        status = STRING_ERROR_APPEND_OVERFLOW;
+        goto errors;
+    }
+    str[(*str_size)] = chr;
+    (*str_size)++;
+errors:
+    return status;
+}
+
+/*******************************************************************/
+static STRING_status_t _STRING_append_field(char_t* str, uint32_t str_size_max, char_t sign, char_t* field, uint32_t field_size, uint8_t width, uint8_t left_justify, char_t padding_char, uint32_t* str_size) {
+    // Local variables.
+    STRING_status_t status = STRING_SUCCESS;
+    uint32_t content_size = (field_size + ((sign != STRING_CHAR_NULL) ? 1 : 0));
+    uint32_t padding_size = (width > content_size) ? (width - content_size) : 0;
+    uint32_t idx = 0;
+    // Check space once for the whole field.
+    if (((*str_size) + content_size + padding_size) > str_size_max) {
+        status = STRING_ERROR_APPEND_OVERFLOW;
+        goto errors;
+    }
+    // Sign is printed before zero padding.
+    if ((sign != STRING_CHAR_NULL) && (padding_char == '0')) {
+        str[(*str_size)++] = sign;
+    }
+    if (left_justify == 0) {
+        for (idx = 0; idx < padding_size; idx++) {
+            str[(*str_size)++] = padding_char;
+        }
+    }
+    if ((sign != STRING_CHAR_NULL) && (padding_char != '0')) {
+        str[(*str_size)++] = sign;
+    }
+    for (idx = 0; idx < field_size; idx++) {
+        str[(*str_size)++] = field[idx];
+    }
+    if (left_justify != 0) {
+        for (idx = 0; idx < padding_size; idx++) {
+            str[(*str_size)++] = STRING_CHAR_SPACE;
+        }
+    }
+errors:
+    return status;
+}
+
+/*******************************************************************/
+static uint32_t _STRING_format_unsigned(uint32_t value, uint32_t base, char_t letter_start, uint8_t number_of_decimals, char_t* field) {
+    // Local variables.
+    uint32_t field_idx = STRING_FORMAT_FIELD_SIZE_MAX;
+    uint8_t number_of_digits = 0;
+    uint8_t digit = 0;
+    // Use fast decimal conversion when possible.
+    if ((base == 10) && (number_of_decimals == 0)) {
+        number_of_digits = _STRING_get_number_of_decimal_digits(value);
+        field_idx -= number_of_digits;
+        _STRING_write_decimal_digits(value, number_of_digits, &(field[field_idx]));
+        goto end;
+    }
+    // Digits are written from the end of the field.
+    do {
+        if ((number_of_decimals != 0) && (number_of_digits == number_of_decimals)) {
+            field[--field_idx] = STRING_CHAR_DOT;
+        }
+        digit = (uint8_t) (value % base);
+        value /= base;
+        field[--field_idx] = (char_t) ((digit <= 9) ? (digit + '0') : (digit + (letter_start - 10)));
+        number_of_digits++;
+    }
+    while ((value != 0) || (number_of_digits <= number_of_decimals));
+end:
+    return field_idx;
+}
+
+/*******************************************************************/
+#define _STRING_integer_to_string(abs_value, negative_flag, size_bits, decimal_function, str_size) { \
+    /* Local variables */ \
+    uint32_t* str_size_ptr = (str_size); \
+    uint32_t str_idx = 0; \
+    uint8_t first_non_zero_found = 0; \
+    uint8_t generic_byte = 0; \
+    int32_t idx = 0; \
+    /* Check parameters */ \
+    _STRING_check_pointer(str); \
+    /* Manage negative numbers */ \
+    if (negative_flag != 0) { \
+        str[str_idx++] = STRING_CHAR_MINUS; \
+    } \
+    /* Build string according to format */ \
+    switch (format) { \
+    case STRING_FORMAT_BOOLEAN: \
+        if (print_prefix != 0) { \
+            str[str_idx++] = '0'; \
+            str[str_idx++] = 'b'; \
+        } \
+        for (idx = ((size_bits) - 1); idx >= 0; idx--) { \
+            if (((abs_value >> idx) & 0b1) != 0) { \
+                str[str_idx++] = '1'; \
+                first_non_zero_found = 1; \
+            } \
+            else { \
+                if ((first_non_zero_found != 0) || (idx == 0)) { \
+                    str[str_idx++] = '0'; \
+                } \
+            } \
+        } \
+        break; \
+    case STRING_FORMAT_HEXADECIMAL: \
+        if (print_prefix != 0) { \
+            str[str_idx++] = '0'; \
+            str[str_idx++] = 'x'; \
+        } \
+        for (idx = (((size_bits) >> 3) - 1); idx >= 0; idx--) { \
+            generic_byte = (uint8_t) ((abs_value >> (idx << 3)) & MATH_U8_MASK); \
+            if (generic_byte != 0) { \
+                first_non_zero_found = 1; \
+            } \
+            if ((first_non_zero_found != 0) || (idx == 0)) { \
+                _STRING_write_hexadecimal_byte(generic_byte, &(str[str_idx])); \
+                str_idx += 2; \
+            } \
+        } \
+        break; \
+    case STRING_FORMAT_DECIMAL: \
+        if (print_prefix != 0) { \
+            str[str_idx++] = '0'; \
+            str[str_idx++] = 'd'; \
+        } \
+        str_idx += decimal_function(abs_value, &(str[str_idx])); \
+        break; \
+    default: \
+        status = STRING_ERROR_FORMAT; \
+        break; \
+    } \
+    /* End string */ \
+    str[str_idx] = STRING_CHAR_NULL; \
+    if (str_size_ptr != NULL) { \
+        (*str_size_ptr) = str_idx; \
+    } \
+}
+
+/*******************************************************************/
+#define _STRING_string_to_integer(result, result_max, signed_flag, hexadecimal_digits_max, decimal_digits_max, value_type) { \
+    /* Local variables */ \
+    uint32_t char_idx = 0; \
+    uint32_t start_idx = 0; \
+    uint8_t negative_flag = 0; \
+    uint8_t digit_value = 0; \
+    /* Check parameters */ \
+    _STRING_check_pointer(str); \
+    _STRING_check_pointer(value); \
+    /* Reset result */ \
+    (*value) = 0; \
+    /* Manage negative numbers */ \
+    if (((signed_flag) != 0) && (str[0] == STRING_CHAR_MINUS)) { \
+        negative_flag = 1; \
+        start_idx++; \
+        /* Magnitude of the minimum value is one more than the maximum value */ \
+        (result_max)++; \
+    } \
+    /* Decode string according to format */ \
+    switch (format) { \
+    case STRING_FORMAT_BOOLEAN: \
+        if (number_of_digits != MATH_BOOLEAN_SIZE_BITS) { \
+            status = STRING_ERROR_BOOLEAN_SIZE; \
+            goto errors; \
+        } \
+        switch (str[start_idx]) { \
+        case '0': \
+            result = 0; \
+            break; \
+        case '1': \
+            result = 1; \
+            break; \
+        default: \
+            status = STRING_ERROR_BOOLEAN_INVALID; \
+            goto errors; \
+        } \
+        break; \
+    case STRING_FORMAT_HEXADECIMAL: \
+        /* Two hexadecimal characters are required to code a byte */ \
+        if ((number_of_digits % 2) != 0) { \
+            status = STRING_ERROR_HEXADECIMAL_ODD_SIZE; \
+            goto errors; \
+        } \
+        if (number_of_digits > (hexadecimal_digits_max)) { \
+            status = STRING_ERROR_HEXADECIMAL_OVERFLOW; \
+            goto errors; \
+        } \
+        for (char_idx = 0; char_idx < number_of_digits; char_idx++) { \
+            status = _STRING_hexadecimal_char_to_digit((str[start_idx + char_idx]), &digit_value); \
+            if (status != STRING_SUCCESS) goto errors; \
+            result = ((result << 4) | digit_value); \
+        } \
+        break; \
+    case STRING_FORMAT_DECIMAL: \
+        if (number_of_digits > (decimal_digits_max)) { \
+            status = STRING_ERROR_DECIMAL_OVERFLOW; \
+            goto errors; \
+        } \
+        for (char_idx = 0; char_idx < number_of_digits; char_idx++) { \
+            status = _STRING_decimal_char_to_digit(str[start_idx + char_idx], &digit_value); \
+            if (status != STRING_SUCCESS) goto errors; \
+            /* Check overflow before accumulating the digit */ \
+            if (result > (((result_max) - digit_value) / 10)) { \
+                status = STRING_ERROR_DECIMAL_OVERFLOW; \
+                goto errors; \
+            } \
+            result = ((result * 10) + digit_value); \
+        } \
+        break; \
+    default: \
+        status = STRING_ERROR_FORMAT; \
+        goto errors; \
+    } \
+    /* Add sign */ \
+    (*value) = (negative_flag != 0) ? ((value_type) (0 - result)) : ((value_type) result); \
+}
+
+/*******************************************************************/
+static uint32_t _STRING_maximal_suffix(STRING_view_t pattern, uint8_t reverse_order_flag, uint32_t* period) {
+    // Local variables.
+    uint8_t* chr = (uint8_t*) pattern.str;
+    uint32_t suffix_idx = 0;
+    uint32_t candidate_idx = 1;
+    uint32_t offset = 1;
+    uint32_t suffix_period = 1;
+    // Compare the current maximal suffix to the candidate one.
+    while ((candidate_idx + offset) <= pattern.size) {
+        if (chr[suffix_idx + offset - 1] == chr[candidate_idx + offset - 1]) {
+            // Advance through repetition of the current period.
+            if (offset == suffix_period) {
+                candidate_idx += suffix_period;
+                offset = 1;
+            }
+            else {
+                offset++;
+            }
+        }
+        else if ((chr[suffix_idx + offset - 1] > chr[candidate_idx + offset - 1]) ^ (reverse_order_flag != 0)) {
+            // Candidate suffix is smaller: skip it.
+            candidate_idx += offset;
+            offset = 1;
+            suffix_period = (candidate_idx - suffix_idx);
+        }
+        else {
+            // Candidate suffix is greater: restart from it.
+            suffix_idx = candidate_idx;
+            candidate_idx++;
+            offset = 1;
+            suffix_period = 1;
+        }
+    }
+    (*period) = suffix_period;
+    return suffix_idx;
+}
+
+/*** STRING functions ***/
+
+/*******************************************************************/
+static STRING_status_t _STRING_int32_to_string(int32_t value, STRING_format_t format, uint8_t print_prefix, char_t* str, uint32_t* str_size) {
+    // Local variables.
+    STRING_status_t status = STRING_SUCCESS;
+    uint32_t abs_value = 0;
+    // Get absolute value.
+    abs_value = (value < 0) ? (0 - ((uint32_t) value)) : ((uint32_t) value);
+    // Convert magnitude.
+    _STRING_integer_to_string(abs_value, (value < 0), MATH_S32_SIZE_BITS, _STRING_uint32_to_decimal_string, str_size);
+errors:
+    return status;
+}
+
+/*******************************************************************/
+STRING_status_t STRING_integer_to_string(int32_t value, STRING_format_t format, uint8_t print_prefix, char_t* str) {
+    return _STRING_int32_to_string(value, format, print_prefix, str, NULL);
+}
+
+/*******************************************************************/
+STRING_status_t STRING_uint32_to_string(uint32_t value, STRING_format_t format, uint8_t print_prefix, char_t* str) {
+    // Local variables.
+    STRING_status_t status = STRING_SUCCESS;
+    // Convert value.
+    _STRING_integer_to_string(value, 0, MATH_U32_SIZE_BITS, _STRING_uint32_to_decimal_string, NULL);
+errors:
+    return status;
+}
+
+/*******************************************************************/
+STRING_status_t STRING_int64_to_string(int64_t value, STRING_format_t format, uint8_t print_prefix, char_t* str) {
+    // Local variables.
+    STRING_status_t status = STRING_SUCCESS;
+    uint64_t abs_value = 0;
+    // Get absolute value.
+    abs_value = (value < 0) ? (0 - ((uint64_t) value)) : ((uint64_t) value);
+    // Convert magnitude.
+    _STRING_integer_to_string(abs_value, (value < 0), MATH_S64_SIZE_BITS, _STRING_uint64_to_decimal_string, NULL);
+errors:
+    return status;
+}
+
+/*******************************************************************/
+STRING_status_t STRING_uint64_to_string(uint64_t value, STRING_format_t format, uint8_t print_prefix, char_t* str) {
+    // Local variables.
+    STRING_status_t status = STRING_SUCCESS;
+    // Convert value.
+    _STRING_integer_to_string(value, 0, MATH_U64_SIZE_BITS, _STRING_uint64_to_decimal_string, NULL);
+errors:
+    return status;
+}
+
+/*******************************************************************/
+STRING_status_t STRING_integer_to_floating_decimal_string(int32_t value, uint8_t divider_exponent, uint8_t number_of_digits, char_t* str) {
+    // Local variables.
+    STRING_status_t status = STRING_SUCCESS;
+    char_t digit_array[MATH_U32_SIZE_DECIMAL_DIGITS];
+    uint8_t number_of_effective_digits = number_of_digits;
+    uint32_t value_abs = 0;
+    uint8_t value_size_digits = 0;
+    uint32_t integer_part = 0;
+    uint8_t integer_part_size_digits = 0;
+    uint8_t number_of_left_zero = 0;
+    uint8_t left_zero_count = 0;
+    uint8_t str_idx = 0;
+    uint8_t digit_idx = 0;
+    uint8_t char_idx = 0;
+    // Init digit array.
+    for (char_idx = 0; char_idx < MATH_U32_SIZE_DECIMAL_DIGITS; char_idx++) {
+        digit_array[char_idx] = '0';
+    }
+    char_idx = 0;
+    // Check parameters.
+    if (number_of_digits == 0) {
+        status = STRING_ERROR_NUMBER_OF_DIGITS_UNDERFLOW;
+        goto errors;
+    }
+    if ((divider_exponent >= MATH_U32_SIZE_DECIMAL_DIGITS) || (number_of_digits > MATH_U32_SIZE_DECIMAL_DIGITS)) {
+        status = STRING_ERROR_DECIMAL_OVERFLOW;
+        goto errors;
+    }
+    if (str == NULL) {
+        status = STRING_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    // Check sign.
+    if (value < 0) {
+        str[str_idx++] = STRING_CHAR_MINUS;
+        number_of_effective_digits--;
+    }
+    if (number_of_effective_digits == 0) {
+        status = STRING_ERROR_NUMBER_OF_DIGITS_UNDERFLOW;
+        goto errors;
+    }
+    // Compute integer part.
+    value_abs = (value < 0) ? (0 - ((uint32_t) value)) : ((uint32_t) value);
+    value_size_digits = _STRING_get_number_of_decimal_digits(value_abs);
+    integer_part = (value_abs / MATH_POWER_10[divider_exponent]);
+    integer_part_size_digits = _STRING_get_number_of_decimal_digits(integer_part);
+    // Check range.
+    if (integer_part_size_digits > number_of_effective_digits) {
+        status = STRING_ERROR_NUMBER_OF_DIGITS_OVERFLOW;
+        goto errors;
+    }
+    // Extract digits.
+    status = _STRING_extract_decimal_digits(value_abs, (char_t*) digit_array);
+    if (status != STRING_SUCCESS) goto errors;
+    // Compute number of left padding zero.
+    if (divider_exponent >= value_size_digits) {
+        number_of_left_zero = (uint8_t) (divider_exponent - value_size_digits + 1);
+    }
+    // Digits loop.
+    while (str_idx < number_of_digits) {
+        // Compute digit.
+        if (char_idx == integer_part_size_digits) {
+            // Check if there is enough space for a decimal part.
+            if ((number_of_effective_digits - char_idx) < 2) break;
+            // Insert dot.
+            str[str_idx++] = STRING_CHAR_DOT;
+        }
+        else {
+            // Left padding.
+            if (left_zero_count < number_of_left_zero) {
+                str[str_idx++] = '0';
+                left_zero_count++;
+            }
+            else {
                 str[str_idx++] = digit_array[digit_idx++];
             }
         }
@@ -319,193 +1309,769 @@ errors:
     return status;
 }
 
+#if (EMBEDDED_UTILS_MATH_PRECISION > 0)
+/*******************************************************************/
+STRING_status_t STRING_float32_to_string(float32_t value, uint8_t number_of_decimals, char_t* str) {
+    // Local variables.
+    STRING_status_t status = STRING_SUCCESS;
+    STRING_float32_t ieee754;
+    // Convert from binary representation.
+    ieee754.value = value;
+    status = _STRING_floating_to_string(ieee754.bits, STRING_FLOAT32_SIGNIFICAND_SIZE_BITS, STRING_FLOAT32_EXPONENT_SIZE_BITS, number_of_decimals, str);
+    return status;
+}
+#endif
+
+#if (EMBEDDED_UTILS_MATH_PRECISION == 2)
+/*******************************************************************/
+STRING_status_t STRING_float64_to_string(float64_t value, uint8_t number_of_decimals, char_t* str) {
+    // Local variables.
+    STRING_status_t status = STRING_SUCCESS;
+    STRING_float64_t ieee754;
+    // Convert from binary representation.
+    ieee754.value = value;
+    status = _STRING_floating_to_string(ieee754.bits, STRING_FLOAT64_SIGNIFICAND_SIZE_BITS, STRING_FLOAT64_EXPONENT_SIZE_BITS, number_of_decimals, str);
+    return status;
+}
+#endif
+
+/*******************************************************************/
+STRING_status_t STRING_string_to_integer(char_t* str, STRING_format_t format, uint8_t number_of_digits, int32_t* value) {
+    // Local variables.
+    STRING_status_t status = STRING_SUCCESS;
+    uint32_t result = 0;
+    uint32_t result_max = MATH_S32_MAX;
+    // Convert string.
+    _STRING_string_to_integer(result, result_max, 1, MATH_S32_SIZE_HEXADECIMAL_DIGITS, MATH_S32_SIZE_DECIMAL_DIGITS, int32_t);
+errors:
+    return status;
+}
+
+/*******************************************************************/
+STRING_status_t STRING_string_to_uint32(char_t* str, STRING_format_t format, uint8_t number_of_digits, uint32_t* value) {
+    // Local variables.
+    STRING_status_t status = STRING_SUCCESS;
+    uint32_t result = 0;
+    uint32_t result_max = MATH_U32_MAX;
+    // Convert string.
+    _STRING_string_to_integer(result, result_max, 0, MATH_U32_SIZE_HEXADECIMAL_DIGITS, MATH_U32_SIZE_DECIMAL_DIGITS, uint32_t);
+errors:
+    return status;
+}
+
+/*******************************************************************/
+STRING_status_t STRING_string_to_int64(char_t* str, STRING_format_t format, uint8_t number_of_digits, int64_t* value) {
+    // Local variables.
+    STRING_status_t status = STRING_SUCCESS;
+    uint64_t result = 0;
+    uint64_t result_max = MATH_S64_MAX;
+    // Convert string.
+    _STRING_string_to_integer(result, result_max, 1, MATH_S64_SIZE_HEXADECIMAL_DIGITS, MATH_S64_SIZE_DECIMAL_DIGITS, int64_t);
+errors:
+    return status;
+}
+
+/*******************************************************************/
+STRING_status_t STRING_string_to_uint64(char_t* str, STRING_format_t format, uint8_t number_of_digits, uint64_t* value) {
+    // Local variables.
+    STRING_status_t status = STRING_SUCCESS;
+    uint64_t result = 0;
+    uint64_t result_max = MATH_U64_MAX;
+    // Convert string.
+    _STRING_string_to_integer(result, result_max, 0, MATH_U64_SIZE_HEXADECIMAL_DIGITS, MATH_U64_SIZE_DECIMAL_DIGITS, uint64_t);
+errors:
+    return status;
+}
+
+/*******************************************************************/
+STRING_status_t STRING_parse_integer(char_t* str, uint32_t str_size_max, int32_t* value, uint32_t* parsed_size) {
+    // Local variables.
+    STRING_status_t status = STRING_SUCCESS;
+    STRING_format_t format = STRING_FORMAT_DECIMAL;
+    uint64_t result = 0;
+    uint64_t result_max = MATH_S32_MAX;
+    uint32_t char_idx = 0;
+    uint32_t digits_start_idx = 0;
+    uint8_t base = 10;
+    uint8_t negative_flag = 0;
+    uint8_t digit_value = 0;
+    // Check parameters.
+    _STRING_check_pointer(str);
+    _STRING_check_pointer(value);
+    _STRING_check_pointer(parsed_size);
+    // Reset results.
+    (*value) = 0;
+    (*parsed_size) = 0;
+    // Manage negative numbers.
+    if ((str_size_max > 0) && (str[0] == STRING_CHAR_MINUS)) {
+        negative_flag = 1;
+        char_idx++;
+    }
+    // Detect base prefix.
+    if (((char_idx + 1) < str_size_max) && (str[char_idx] == '0')) {
+        switch (str[char_idx + 1]) {
+        case 'x':
+        case 'X':
+            format = STRING_FORMAT_HEXADECIMAL;
+            base = 16;
+            result_max = MATH_U32_MAX;
+            char_idx += 2;
+            break;
+        case 'b':
+        case 'B':
+            format = STRING_FORMAT_BOOLEAN;
+            base = 2;
+            result_max = MATH_U32_MAX;
+            char_idx += 2;
+            break;
+        case 'd':
+        case 'D':
+            char_idx += 2;
+            break;
+        default:
+            break;
+        }
+    }
+    // Negative values are limited to the opposite of the minimum value whatever the base.
+    if (negative_flag != 0) {
+        result_max = ((uint64_t) MATH_S32_MAX + 1);
+    }
+    // Convert digits until the first character which is not valid in the detected base.
+    digits_start_idx = char_idx;
+    while (char_idx < str_size_max) {
+        digit_value = _STRING_hexadecimal_char_to_value(str[char_idx]);
+        if (digit_value >= base) break;
+        result = (result * base) + digit_value;
+        if (result > result_max) {
+            status = (format == STRING_FORMAT_HEXADECIMAL) ? STRING_ERROR_HEXADECIMAL_OVERFLOW : ((format == STRING_FORMAT_BOOLEAN) ? STRING_ERROR_NUMBER_OF_DIGITS_OVERFLOW : STRING_ERROR_DECIMAL_OVERFLOW);
+            goto errors;
+        }
+        char_idx++;
+    }
+    // Check that at least one digit has been found.
+    if (char_idx == digits_start_idx) {
+        status = (format == STRING_FORMAT_HEXADECIMAL) ? STRING_ERROR_HEXADECIMAL_INVALID : ((format == STRING_FORMAT_BOOLEAN) ? STRING_ERROR_BOOLEAN_INVALID : STRING_ERROR_DECIMAL_INVALID);
+        goto errors;
+    }
+    // Add sign.
+    (*value) = (negative_flag != 0) ? ((int32_t) (0 - (uint32_t) result)) : ((int32_t) result);
+    (*parsed_size) = char_idx;
+errors:
+    return status;
+}
+
+/*******************************************************************/
+STRING_status_t STRING_floating_decimal_string_to_integer(char_t* str, uint32_t str_size, uint8_t multiplier_exponent, int32_t* value) {
+    // Local variables.
+    STRING_status_t status = STRING_SUCCESS;
+    uint64_t result = 0;
+    uint64_t result_max = MATH_S32_MAX;
+    uint32_t mantissa_start_idx = 0;
+    uint32_t mantissa_end_idx = 0;
+    uint32_t number_of_mantissa_digits = 0;
+    uint32_t number_of_fraction_digits = 0;
+    uint32_t char_idx = 0;
+    int32_t exponent = 0;
+    int32_t weight = 0;
+    uint8_t negative_flag = 0;
+    uint8_t negative_exponent_flag = 0;
+    uint8_t point_flag = 0;
+    uint8_t round_up_flag = 0;
+    uint8_t digit_value = 0;
+    // Check parameters.
+    _STRING_check_pointer(str);
+    _STRING_check_pointer(value);
+    if (str_size == 0) {
+        status = STRING_ERROR_NUMBER_OF_DIGITS_UNDERFLOW;
+        goto errors;
+    }
+    // Reset result.
+    (*value) = 0;
+    // Manage sign.
+    if ((str[0] == STRING_CHAR_MINUS) || (str[0] == '+')) {
+        negative_flag = (str[0] == STRING_CHAR_MINUS) ? 1 : 0;
+        char_idx++;
+    }
+    // Check mantissa syntax.
+    mantissa_start_idx = char_idx;
+    while (char_idx < str_size) {
+        if (_STRING_is_decimal_char(str[char_idx]) == STRING_SUCCESS) {
+            number_of_mantissa_digits++;
+            number_of_fraction_digits += point_flag;
+        }
+        else if ((str[char_idx] == STRING_CHAR_DOT) && (point_flag == 0)) {
+            point_flag = 1;
+        }
+        else if ((str[char_idx] == 'e') || (str[char_idx] == 'E')) {
+            break;
+        }
+        else {
+            status = STRING_ERROR_DECIMAL_INVALID;
+            goto errors;
+        }
+        char_idx++;
+    }
+    mantissa_end_idx = char_idx;
+    if (number_of_mantissa_digits == 0) {
+        status = STRING_ERROR_DECIMAL_INVALID;
+        goto errors;
+    }
+    // Parse optional exponent.
+    if (char_idx < str_size) {
+        char_idx++;
+        if ((char_idx < str_size) && ((str[char_idx] == STRING_CHAR_MINUS) || (str[char_idx] == '+'))) {
+            negative_exponent_flag = (str[char_idx] == STRING_CHAR_MINUS) ? 1 : 0;
+            char_idx++;
+        }
+        if (char_idx >= str_size) {
+            status = STRING_ERROR_DECIMAL_INVALID;
+            goto errors;
+        }
+        for (; char_idx < str_size; char_idx++) {
+            status = _STRING_decimal_char_to_digit(str[char_idx], &digit_value);
+            if (status != STRING_SUCCESS) goto errors;
+            exponent = (exponent * 10) + digit_value;
+            if (exponent > STRING_FLOATING_EXPONENT_MAX) {
+                exponent = STRING_FLOATING_EXPONENT_MAX;
+            }
+        }
+        if (negative_exponent_flag != 0) {
+            exponent = -exponent;
+        }
+    }
+    // Power of 10 applied to the first mantissa digit in the scaled result.
+    weight = (exponent + multiplier_exponent + (int32_t) (number_of_mantissa_digits - number_of_fraction_digits) - 1);
+    if (negative_flag != 0) {
+        result_max++;
+    }
+    // Accumulate digits of positive weight, the first digit of weight -1 gives the rounding.
+    for (char_idx = mantissa_start_idx; char_idx < mantissa_end_idx; char_idx++) {
+        if (str[char_idx] == STRING_CHAR_DOT) continue;
+        digit_value = (uint8_t) (str[char_idx] - '0');
+        if (weight >= 0) {
+            result = (result * 10) + digit_value;
+            if (result > result_max) {
+                status = STRING_ERROR_DECIMAL_OVERFLOW;
+                goto errors;
+            }
+        }
+        else {
+            if (weight == -1) {
+                round_up_flag = (digit_value >= 5) ? 1 : 0;
+            }
+            break;
+        }
+        weight--;
+    }
+    // Append zeros if the scale exceeds the number of digits.
+    while ((weight >= 0) && (result != 0)) {
+        result *= 10;
+        if (result > result_max) {
+            status = STRING_ERROR_DECIMAL_OVERFLOW;
+            goto errors;
+        }
+        weight--;
+    }
+    // Round half away from zero.
+    result += round_up_flag;
+    if (result > result_max) {
+        status = STRING_ERROR_DECIMAL_OVERFLOW;
+        goto errors;
+    }
+    (*value) = (negative_flag != 0) ? ((int32_t) (0 - result)) : ((int32_t) result);
+errors:
+    return status;
+}
+
+/*******************************************************************/
+STRING_status_t STRING_byte_array_to_hexadecimal_string(uint8_t* data, uint32_t data_size_bytes, uint8_t print_prefix, char_t* str) {
+    // Local variables.
+    STRING_status_t status = STRING_SUCCESS;
+    uint32_t str_idx = 0;
+    // Check parameters.
+    _STRING_check_pointer(data);
+    _STRING_check_pointer(str);
+    // Print prefix once.
+    if (print_prefix != 0) {
+        str[str_idx++] = '0';
+        str[str_idx++] = 'x';
+    }
+    // Build string by words.
+    _STRING_write_hexadecimal_bytes(data, data_size_bytes, &(str[str_idx]));
+    str_idx += (data_size_bytes << 1);
+    str[str_idx] = STRING_CHAR_NULL; // End string.
+errors:
+    return status;
+}
+
+/*******************************************************************/
+STRING_status_t STRING_hexadecimal_string_to_byte_array(char_t* str, char_t end_character, uint8_t* data, uint32_t* extracted_size) {
+    // Local variables.
+    STRING_status_t status = STRING_SUCCESS;
+    uint32_t char_idx = 0;
+    uint8_t high_value = 0;
+    uint8_t low_value = 0;
+    uint8_t word_flag = 0;
+    // Check parameters.
+    _STRING_check_pointer(str);
+    _STRING_check_pointer(data);
+    _STRING_check_pointer(extracted_size);
+    // Reset extracted size.
+    (*extracted_size) = 0;
+    // Words can only be converted at once if the end character is not a digit.
+    word_flag = (_STRING_hexadecimal_char_to_value(end_character) == STRING_HEXADECIMAL_VALUE_INVALID) ? 1 : 0;
+    // Bytes loop: each character is checked and converted with a single table lookup.
+    while ((str[char_idx] != end_character) && (str[char_idx] != STRING_CHAR_NULL)) {
+        // Aligned words of four valid characters.
+        if ((word_flag != 0) && (_STRING_is_word_aligned(&(str[char_idx])) != 0) && (_STRING_hexadecimal_word_to_bytes(&(str[char_idx]), &(data[*extracted_size])) != 0)) {
+            char_idx += 4;
+            (*extracted_size) += 2;
+            continue;
+        }
+        // High nibble.
+        high_value = _STRING_hexadecimal_char_to_value(str[char_idx]);
+        if (high_value == STRING_HEXADECIMAL_VALUE_INVALID) {
+            status = STRING_ERROR_HEXADECIMAL_INVALID;
+            goto errors;
+        }
+        // Low nibble.
+        low_value = _STRING_hexadecimal_char_to_value(str[char_idx + 1]);
+        if ((str[char_idx + 1] == end_character) || (low_value == STRING_HEXADECIMAL_VALUE_INVALID)) {
+            status = STRING_ERROR_HEXADECIMAL_ODD_SIZE;
+            goto errors;
+        }
+        // Append byte.
+        data[(*extracted_size)++] = (uint8_t) ((high_value << 4) | low_value);
+        char_idx += 2;
+    }
+errors:
+    return status;
+}
+
+/*******************************************************************/
+STRING_status_t STRING_base64_init_encoder(STRING_base64_encoder_t* encoder) {
+    // Local variables.
+    STRING_status_t status = STRING_SUCCESS;
+    // Check parameters.
+    _STRING_check_pointer(encoder);
+    // Reset context.
+    (encoder->number_of_bytes) = 0;
+errors:
+    return status;
+}
+
+/*******************************************************************/
+STRING_status_t STRING_base64_encode(STRING_base64_encoder_t* encoder, uint8_t* data, uint32_t data_size_bytes, char_t* str, uint32_t str_size_max, uint32_t* str_size) {
+    // Local variables.
+    STRING_status_t status = STRING_SUCCESS;
+    uint32_t triplet = 0;
+    uint32_t size = 0;
+    uint32_t idx = 0;
+    // Check parameters.
+    _STRING_check_pointer(encoder);
+    _STRING_check_pointer(data);
+    _STRING_check_pointer(str);
+    _STRING_check_pointer(str_size);
+    // Check space once for all complete triplets, nothing is written on overflow.
+    if (((*str_size) > str_size_max) || (STRING_BASE64_SIZE_FLOOR((encoder->number_of_bytes) + data_size_bytes) > (str_size_max - (*str_size)))) {
+        status = STRING_ERROR_APPEND_OVERFLOW;
+        goto errors;
+    }
+    size = (*str_size);
+    // Complete the triplet pending from the previous chunk.
+    if (((encoder->number_of_bytes) != 0) && (((encoder->number_of_bytes) + data_size_bytes) >= 3)) {
+        triplet = ((uint32_t) (encoder->bytes)[0] << 16);
+        if ((encoder->number_of_bytes) == 2) {
+            triplet |= ((uint32_t) (encoder->bytes)[1] << 8) | data[idx++];
+        }
+        else {
+            triplet |= ((uint32_t) data[idx] << 8) | data[idx + 1];
+            idx += 2;
+        }
+        _STRING_write_base64_quartet(triplet, &(str[size]));
+        size += 4;
+        (encoder->number_of_bytes) = 0;
+    }
+    // Complete triplets.
+    while ((data_size_bytes - idx) >= 3) {
+        triplet = ((uint32_t) data[idx] << 16) | ((uint32_t) data[idx + 1] << 8) | data[idx + 2];
+        _STRING_write_base64_quartet(triplet, &(str[size]));
+        size += 4;
+        idx += 3;
+    }
+    // Keep remaining bytes for the next chunk.
+    while (idx < data_size_bytes) {
+        (encoder->bytes)[(encoder->number_of_bytes)++] = data[idx++];
+    }
+    (*str_size) = size;
+errors:
+    return status;
+}
+
+/*******************************************************************/
+STRING_status_t STRING_base64_encode_final(STRING_base64_encoder_t* encoder, char_t* str, uint32_t str_size_max, uint32_t* str_size) {
+    // Local variables.
+    STRING_status_t status = STRING_SUCCESS;
+    uint32_t triplet = 0;
+    char_t quartet[4];
+    uint8_t idx = 0;
+    // Check parameters.
+    _STRING_check_pointer(encoder);
+    _STRING_check_pointer(str);
+    _STRING_check_pointer(str_size);
+    // Nothing to do if the data size was a multiple of 3.
+    if ((encoder->number_of_bytes) == 0) goto errors;
+    // Check space.
+    if (((*str_size) > str_size_max) || ((str_size_max - (*str_size)) < 4)) {
+        status = STRING_ERROR_APPEND_OVERFLOW;
+        goto errors;
+    }
+    // Encode last bytes and add padding.
+    triplet = ((uint32_t) (encoder->bytes)[0] << 16);
+    if ((encoder->number_of_bytes) == 2) {
+        triplet |= ((uint32_t) (encoder->bytes)[1] << 8);
+    }
+    _STRING_write_base64_quartet(triplet, quartet);
+    if ((encoder->number_of_bytes) == 1) {
+        quartet[2] = STRING_BASE64_PADDING;
+    }
+    quartet[3] = STRING_BASE64_PADDING;
+    for (idx = 0; idx < 4; idx++) {
+        str[(*str_size)++] = quartet[idx];
+    }
+    (encoder->number_of_bytes) = 0;
+errors:
+    return status;
+}
+
+/*******************************************************************/
+STRING_status_t STRING_base64_init_decoder(STRING_base64_decoder_t* decoder) {
+    // Local variables.
+    STRING_status_t status = STRING_SUCCESS;
+    // Check parameters.
+    _STRING_check_pointer(decoder);
+    // Reset context.
+    (decoder->bits) = 0;
+    (decoder->number_of_chars) = 0;
+    (decoder->padding_size) = 0;
+errors:
+    return status;
+}
+
+/*******************************************************************/
+STRING_status_t STRING_base64_decode(STRING_base64_decoder_t* decoder, char_t* str, uint32_t str_size, uint8_t* data, uint32_t data_size_max, uint32_t* data_size) {
+    // Local variables.
+    STRING_status_t status = STRING_SUCCESS;
+    uint32_t idx = 0;
+    uint8_t char_value = 0;
+    uint8_t number_of_bytes = 0;
+    // Check parameters.
+    _STRING_check_pointer(decoder);
+    _STRING_check_pointer(str);
+    _STRING_check_pointer(data);
+    _STRING_check_pointer(data_size);
+    // Characters loop.
+    for (idx = 0; idx < str_size; idx++) {
+        if (str[idx] == STRING_BASE64_PADDING) {
+            // Padding can only replace the last 2 characters of a quartet.
+            if ((decoder->number_of_chars) < 2) {
+                status = STRING_ERROR_BASE64_INVALID;
+                goto errors;
+            }
+            (decoder->bits) <<= 6;
+            (decoder->padding_size)++;
+        }
+        else {
+            // No data is allowed after padding.
+            char_value = _STRING_base64_char_to_value(str[idx]);
+            if ((char_value == STRING_BASE64_VALUE_INVALID) || ((decoder->padding_size) != 0)) {
+                status = STRING_ERROR_BASE64_INVALID;
+                goto errors;
+            }
+            (decoder->bits) = ((decoder->bits) << 6) | char_value;
+        }
+        (decoder->number_of_chars)++;
+        // Output bytes when a quartet is complete.
+        if ((decoder->number_of_chars) == 4) {
+            number_of_bytes = (uint8_t) (3 - (decoder->padding_size));
+            if (((*data_size) > data_size_max) || (number_of_bytes > (data_size_max - (*data_size)))) {
+                status = STRING_ERROR_BASE64_OVERFLOW;
+                goto errors;
+            }
+            data[(*data_size)++] = (uint8_t) ((decoder->bits) >> 16);
+            if (number_of_bytes > 1) {
+                data[(*data_size)++] = (uint8_t) ((decoder->bits) >> 8);
+            }
+            if (number_of_bytes > 2) {
+                data[(*data_size)++] = (uint8_t) (decoder->bits);
+            }
+            (decoder->bits) = 0;
+            (decoder->number_of_chars) = 0;
+        }
+    }
+errors:
+    return status;
+}
+
+/*******************************************************************/
+STRING_status_t STRING_base64_decode_final(STRING_base64_decoder_t* decoder, uint8_t* data, uint32_t data_size_max, uint32_t* data_size) {
+    // Local variables.
+    STRING_status_t status = STRING_SUCCESS;
+    uint8_t number_of_bytes = 0;
+    // Check parameters.
+    _STRING_check_pointer(decoder);
+    _STRING_check_pointer(data);
+    _STRING_check_pointer(data_size);
+    // Nothing to do if the last quartet is complete.
+    if ((decoder->number_of_chars) == 0) goto errors;
+    // Unpadded input can end with 2 or 3 characters.
+    if (((decoder->padding_size) != 0) || ((decoder->number_of_chars) < 2)) {
+        status = STRING_ERROR_BASE64_SIZE;
+        goto errors;
+    }
+    number_of_bytes = (uint8_t) ((decoder->number_of_chars) - 1);
+    if (((*data_size) > data_size_max) || (number_of_bytes > (data_size_max - (*data_size)))) {
+        status = STRING_ERROR_BASE64_OVERFLOW;
+        goto errors;
+    }
+    (decoder->bits) <<= (6 * (4 - (decoder->number_of_chars)));
+    data[(*data_size)++] = (uint8_t) ((decoder->bits) >> 16);
+    if (number_of_bytes > 1) {
+        data[(*data_size)++] = (uint8_t) ((decoder->bits) >> 8);
+    }
+    (decoder->bits) = 0;
+    (decoder->number_of_chars) = 0;
+errors:
+    return status;
+}
+
+/*******************************************************************/
+STRING_status_t STRING_get_size(char_t* str, uint32_t* size) {
+    // Local variables.
+    STRING_status_t status = STRING_SUCCESS;
+    // Null character must be found within the first (STRING_SIZE_MAX + 1) characters.
+    status = STRING_get_bounded_size(str, (STRING_SIZE_MAX + 1), size);
+    return status;
+}
+
+/*******************************************************************/
+STRING_status_t STRING_get_view(char_t* str, STRING_view_t* view) {
+    // Local variables.
+    STRING_status_t status = STRING_SUCCESS;
+    // Check parameters.
+    _STRING_check_pointer(view);
+    // Compute size once.
+    status = STRING_get_size(str, &(view->size));
+    if (status != STRING_SUCCESS) goto errors;
+    (view->str) = str;
+errors:
+    return status;
+}
+
 /*******************************************************************/
-STRING_status_t STRING_string_to_integer(char_t* str, STRING_format_t format, uint8_t number_of_digits, int32_t* value) {
+// Address sanitizer is disabled since the word containing the null character may be read beyond the end of the string.
+STRING_status_t __attribute__((no_sanitize_address)) STRING_get_bounded_size(char_t* str, uint32_t str_size_max, uint32_t* size) {
     // Local variables.
     STRING_status_t status = STRING_SUCCESS;
-    uint32_t char_idx = 0;
-    uint32_t start_idx = 0;
-    uint8_t negative_flag = 0;
-    uint8_t digit_value = 0;
+    uint32_t idx = 0;
     // Check parameters.
     _STRING_check_pointer(str);
-    _STRING_check_pointer(value);
+    _STRING_check_pointer(size);
     // Reset result.
-    (*value) = 0;
-    // Manage negative numbers.
-    if (str[0] == STRING_CHAR_MINUS) {
-        // Set flag and increment start index to skip minus symbol.
-        negative_flag = 1;
-        start_idx++;
-    }
-    // Decode string according to format.
-    switch (format) {
-    case STRING_FORMAT_BOOLEAN:
-        // Check if there is only 1 digit (start and end index are equal).
-        if (number_of_digits != MATH_BOOLEAN_SIZE_BITS) {
-            status = STRING_ERROR_BOOLEAN_SIZE;
-            goto errors;
-        }
-        // Get digit and check if it is a bit.
-        switch (str[start_idx]) {
-        case '0':
-            (*value) = 0;
-            break;
-        case '1':
-            (*value) = 1;
-            break;
-        default:
-            status = STRING_ERROR_BOOLEAN_INVALID;
-            goto errors;
-        }
-        break;
-    case STRING_FORMAT_HEXADECIMAL:
-        // Check if parameter has an even number of digits (two hexadecimal characters are required to code a byte).
-        if ((number_of_digits % 2) != 0) {
-            status = STRING_ERROR_HEXADECIMAL_ODD_SIZE;
-            goto errors;
-        }
-        // Check if parameter can be binary coded on 32 bits.
-        if (number_of_digits > MATH_S32_SIZE_HEXADECIMAL_DIGITS) {
-            status = STRING_ERROR_HEXADECIMAL_OVERFLOW;
-            goto errors;
-        }
-        // Hexadecimal digits loop.
-        for (char_idx = 0; char_idx < number_of_digits; char_idx++) {
-            // Convert digit to value.
-            status = _STRING_hexadecimal_char_to_digit((str[start_idx + char_idx]), &digit_value);
-            if (status != STRING_SUCCESS) goto errors;
-            // Add digit to result.
-            (*value) |= (digit_value << ((number_of_digits - char_idx - 1) << 2));
-        }
-        break;
-    case STRING_FORMAT_DECIMAL:
-        // Check if parameter can be binary coded on 32 bits.
-        if (number_of_digits > MATH_S32_SIZE_DECIMAL_DIGITS) {
-            // Error in parameter -> value is too large.
-            status = STRING_ERROR_DECIMAL_OVERFLOW;
-            goto errors;
-        }
-        // Decimal digits loop.
-        for (char_idx = 0; char_idx < number_of_digits; char_idx++) {
-            // Convert digit to value.
-            status = _STRING_decimal_char_to_digit(str[start_idx + char_idx], &digit_value);
-            if (status != STRING_SUCCESS) goto errors;
-            // Add digit to result.
-            (*value) += (int32_t) (digit_value * MATH_POWER_10[number_of_digits - char_idx - 1]);
+    (*size) = 0;
+    // Byte loop until word alignment.
+    while ((idx < str_size_max) && (str[idx] != STRING_CHAR_NULL) && (_STRING_is_word_aligned(&(str[idx])) == 0)) {
+        idx++;
+    }
+    // Word loop: only whole aligned words located inside the buffer are read.
+    if (_STRING_is_word_aligned(&(str[idx])) != 0) {
+        while (((str_size_max - idx) >= sizeof(STRING_word_t)) && (_STRING_word_has_null(*((STRING_word_t*) &(str[idx]))) == 0)) {
+            idx += sizeof(STRING_word_t);
         }
-        break;
-    default:
-        status = STRING_ERROR_FORMAT;
-        goto errors;
     }
-    // Add sign.
-    if (negative_flag != 0) {
-        (*value) = (-1) * (*value);
+    // Locate null character in the last word.
+    while ((idx < str_size_max) && (str[idx] != STRING_CHAR_NULL)) {
+        idx++;
+    }
+    // Check overflow.
+    if (idx >= str_size_max) {
+        status = STRING_ERROR_SIZE_OVERFLOW;
+        goto errors;
     }
+    (*size) = idx;
 errors:
     return status;
 }
 
 /*******************************************************************/
-STRING_status_t STRING_byte_array_to_hexadecimal_string(uint8_t* data, uint32_t data_size_bytes, uint8_t print_prefix, char_t* str) {
+STRING_status_t STRING_search_char(char_t* str, uint32_t str_size, char_t chr, uint32_t* index) {
     // Local variables.
     STRING_status_t status = STRING_SUCCESS;
+    STRING_word_t pattern = _STRING_word_broadcast(chr);
     uint32_t idx = 0;
     // Check parameters.
-    _STRING_check_pointer(data);
     _STRING_check_pointer(str);
-    // Build string.
-    for (idx = 0; idx < data_size_bytes; idx++) {
-        status = STRING_integer_to_string((int32_t) data[idx], STRING_FORMAT_HEXADECIMAL, print_prefix, &(str[idx << 1]));
-        if (status != STRING_SUCCESS) goto errors;
+    _STRING_check_pointer(index);
+    // Byte loop until word alignment.
+    while ((idx < str_size) && (str[idx] != chr) && (_STRING_is_word_aligned(&(str[idx])) == 0)) {
+        idx++;
+    }
+    // Word loop: matching bytes become null after the XOR with the broadcast character.
+    if ((idx < str_size) && (_STRING_is_word_aligned(&(str[idx])) != 0)) {
+        while (((str_size - idx) >= sizeof(STRING_word_t)) && (_STRING_word_has_null((*((STRING_word_t*) &(str[idx]))) ^ pattern) == 0)) {
+            idx += sizeof(STRING_word_t);
+        }
+    }
+    // Locate character in the last word.
+    while ((idx < str_size) && (str[idx] != chr)) {
+        idx++;
+    }
+    if (idx >= str_size) {
+        status = STRING_ERROR_SEARCH_NOT_FOUND;
+        goto errors;
     }
+    (*index) = idx;
 errors:
-    str[idx << 1] = STRING_CHAR_NULL; // End string.
     return status;
 }
 
 /*******************************************************************/
-STRING_status_t STRING_hexadecimal_string_to_byte_array(char_t* str, char_t end_character, uint8_t* data, uint32_t* extracted_size) {
+STRING_status_t STRING_search_any(char_t* str, uint32_t str_size, char_t* set, uint32_t* index) {
     // Local variables.
     STRING_status_t status = STRING_SUCCESS;
-    uint32_t char_idx = 0;
-    int32_t value = 0;
+    uint32_t bitmap[8] = { 0 };
+    uint32_t idx = 0;
     // Check parameters.
     _STRING_check_pointer(str);
-    _STRING_check_pointer(data);
-    _STRING_check_pointer(extracted_size);
-    // Reset extracted size.
-    (*extracted_size) = 0;
-    // Char loop.
-    while ((str[char_idx] != end_character) && (str[char_idx] != STRING_CHAR_NULL)) {
-        // Check character.
-        if ((char_idx % 2) == 0) {
-            status = _STRING_is_hexadecimal_char(str[char_idx]);
-            if (status != STRING_SUCCESS) goto errors;
-        }
-        else {
-            // Check character.
-            if (_STRING_is_hexadecimal_char(str[char_idx]) != STRING_SUCCESS) {
-                status = STRING_ERROR_HEXADECIMAL_ODD_SIZE;
-                goto errors;
-            }
-            // Convert byte.
-            status = STRING_string_to_integer(&(str[char_idx - 1]), STRING_FORMAT_HEXADECIMAL, 2, &value);
-            if (status != STRING_SUCCESS) goto errors;
-            // Append byte.
-            data[char_idx >> 1] = (uint8_t) value;
-            (*extracted_size)++;
-        }
-        char_idx++;
+    _STRING_check_pointer(set);
+    _STRING_check_pointer(index);
+    // Build characters set bitmap.
+    for (idx = 0; set[idx] != STRING_CHAR_NULL; idx++) {
+        _STRING_bitmap_set(bitmap, set[idx]);
     }
-    // Check that the number of analyzed characters is even.
-    if ((char_idx % 2) != 0) {
-        status = STRING_ERROR_HEXADECIMAL_ODD_SIZE;
+    // Search first character of the set.
+    for (idx = 0; idx < str_size; idx++) {
+        if (_STRING_bitmap_get(bitmap, str[idx]) != 0) break;
+    }
+    if (idx >= str_size) {
+        status = STRING_ERROR_SEARCH_NOT_FOUND;
         goto errors;
     }
+    (*index) = idx;
 errors:
     return status;
 }
 
 /*******************************************************************/
-STRING_status_t STRING_get_size(char_t* str, uint32_t* size) {
+STRING_status_t STRING_search_view(char_t* str, uint32_t str_size, STRING_view_t pattern, uint32_t* index) {
     // Local variables.
     STRING_status_t status = STRING_SUCCESS;
+    uint8_t* text = (uint8_t*) str;
+    uint8_t* chr = (uint8_t*) pattern.str;
+    uint32_t split_idx = 0;
+    uint32_t reverse_split_idx = 0;
+    uint32_t period = 0;
+    uint32_t reverse_period = 0;
+    uint32_t memory = 0;
+    uint32_t memory_reset = 0;
+    uint32_t position = 0;
+    uint32_t idx = 0;
     // Check parameters.
     _STRING_check_pointer(str);
-    _STRING_check_pointer(size);
-    // Reset result.
-    (*size) = 0;
-    // Compute source buffer size.
-    while (str[(*size)] != STRING_CHAR_NULL) {
-        (*size)++;
-        // Check overflow.
-        if ((*size) > STRING_SIZE_MAX) {
-            status = STRING_ERROR_SIZE_OVERFLOW;
+    _STRING_check_pointer(pattern.str);
+    _STRING_check_pointer(index);
+    // Trivial cases.
+    if (pattern.size > str_size) {
+        status = STRING_ERROR_SEARCH_NOT_FOUND;
+        goto errors;
+    }
+    if (pattern.size <= 1) {
+        (*index) = 0;
+        if (pattern.size != 0) {
+            status = STRING_search_char(str, str_size, pattern.str[0], index);
+        }
+        goto errors;
+    }
+    // Critical factorization of the pattern.
+    split_idx = _STRING_maximal_suffix(pattern, 0, &period);
+    reverse_split_idx = _STRING_maximal_suffix(pattern, 1, &reverse_period);
+    if (reverse_split_idx > split_idx) {
+        split_idx = reverse_split_idx;
+        period = reverse_period;
+    }
+    // Check if the left part is repeated within the period.
+    for (idx = 0; idx < split_idx; idx++) {
+        if (chr[idx] != chr[idx + period]) break;
+    }
+    if (idx < split_idx) {
+        // Non periodic pattern: shift by a value lower than the actual period and forget previous matches.
+        period = ((split_idx > (pattern.size - split_idx)) ? (split_idx - 1) : (pattern.size - split_idx)) + 1;
+        memory_reset = 0;
+    }
+    else {
+        // Periodic pattern: the prefix matched before the shift does not need to be compared again.
+        memory_reset = (pattern.size - period);
+    }
+    // Search loop.
+    while ((str_size - position) >= pattern.size) {
+        // Compare right part.
+        idx = (split_idx > memory) ? split_idx : memory;
+        while ((idx < pattern.size) && (chr[idx] == text[position + idx])) {
+            idx++;
+        }
+        if (idx < pattern.size) {
+            position += (idx - split_idx + 1);
+            memory = 0;
+            continue;
+        }
+        // Compare left part.
+        idx = split_idx;
+        while ((idx > memory) && (chr[idx - 1] == text[position + idx - 1])) {
+            idx--;
+        }
+        if (idx <= memory) {
+            (*index) = position;
             goto errors;
         }
+        position += period;
+        memory = memory_reset;
     }
+    status = STRING_ERROR_SEARCH_NOT_FOUND;
 errors:
     return status;
 }
 
 /*******************************************************************/
 STRING_status_t STRING_copy(STRING_copy_t* copy) {
+    // Local variables.
+    STRING_status_t status = STRING_SUCCESS;
+    STRING_view_t source;
+    // Check parameters.
+    _STRING_check_pointer(copy);
+    // Compute source buffer size.
+    status = STRING_get_view((copy->source), &source);
+    if (status != STRING_SUCCESS) goto errors;
+    // Perform copy.
+    status = STRING_copy_view(copy, source);
+errors:
+    return status;
+}
+
+/*******************************************************************/
+STRING_status_t STRING_copy_view(STRING_copy_t* copy, STRING_view_t source) {
     // Local variables.
     STRING_status_t status = STRING_SUCCESS;
     uint32_t idx = 0;
-    uint32_t source_size = 0;
+    uint32_t source_size = source.size;
     uint32_t start_idx = 0;
-    uint32_t destination_idx = 0;
+    // Check parameters.
+    _STRING_check_pointer(copy);
+    _STRING_check_pointer(source.str);
     // Reset destination buffer if required.
     if ((copy->flush_flag) != 0) {
         for (idx = 0; idx < (copy->destination_size); idx++)
             (copy->destination)[idx] = (copy->flush_char);
     }
-    // Compute source buffer size.
-    status = STRING_get_size((copy->source), &source_size);
-    if (status != STRING_SUCCESS) goto errors;
     // Check size.
     if (source_size > (copy->destination_size)) {
         status = STRING_ERROR_COPY_OVERFLOW;
@@ -526,16 +2092,9 @@ STRING_status_t STRING_copy(STRING_copy_t* copy) {
         status = STRING_ERROR_TEXT_JUSTIFICATION;
         goto errors;
     }
-    // Char loop.
-    idx = 0;
-    while ((copy->source)[idx] != STRING_CHAR_NULL) {
-        // Check index.
-        if (destination_idx >= ((copy->destination_size) - 1)) {
-            status = STRING_ERROR_COPY_OVERFLOW;
-            goto errors;
-        }
-        (copy->destination)[start_idx + idx] = (copy->source)[idx];
-        idx++;
+    // Char loop (size has already been checked).
+    for (idx = 0; idx < source_size; idx++) {
+        (copy->destination)[start_idx + idx] = source.str[idx];
     }
 errors:
     return status;
@@ -566,16 +2125,156 @@ errors:
     return status;
 }
 
+/*******************************************************************/
+STRING_status_t STRING_append_view(char_t* str, uint32_t str_size_max, STRING_view_t view, uint32_t* str_size) {
+    // Local variables.
+    STRING_status_t status = STRING_SUCCESS;
+    uint32_t copy_size = view.size;
+    uint32_t idx = 0;
+    // Check parameters.
+    _STRING_check_pointer(str);
+    _STRING_check_pointer(view.str);
+    _STRING_check_pointer(str_size);
+    if ((*str_size) > str_size_max) {
+        status = STRING_ERROR_APPEND_OVERFLOW;
+        goto errors;
+    }
+    // Check space once and truncate like the string version.
+    if (copy_size > (str_size_max - (*str_size))) {
+        copy_size = (str_size_max - (*str_size));
+        status = STRING_ERROR_APPEND_OVERFLOW;
+    }
+    // Fill buffer.
+    for (idx = 0; idx < copy_size; idx++) {
+        str[(*str_size) + idx] = view.str[idx];
+    }
+    (*str_size) += copy_size;
+errors:
+    return status;
+}
+
 /*******************************************************************/
 STRING_status_t STRING_append_integer(char_t* str, uint32_t str_size_max, int32_t value, STRING_format_t format, uint8_t print_prefix, uint32_t* str_size) {
     // Local variables.
     STRING_status_t status = STRING_SUCCESS;
-    char_t str_value[STRING_VALUE_BUFFER_SIZE] = { STRING_CHAR_NULL };
-    // Convert value to string.
-    status = STRING_integer_to_string(value, format, print_prefix, str_value);
-    if (status != STRING_SUCCESS) goto errors;
-    // Add string.
-    status = STRING_append_string(str, str_size_max, str_value, str_size);
+    char_t str_value[STRING_INTEGER_SIZE_MAX + 1];
+    uint32_t value_size = 0;
+    // Check parameters.
+    _STRING_check_pointer(str);
+    _STRING_check_pointer(str_size);
+    if ((*str_size) > str_size_max) {
+        status = STRING_ERROR_APPEND_OVERFLOW;
+        goto errors;
+    }
+    // Check remaining space (including end character written by the conversion).
+    if ((str_size_max - (*str_size)) > STRING_INTEGER_SIZE_MAX) {
+        // Convert value directly into the destination.
+        status = _STRING_int32_to_string(value, format, print_prefix, &(str[*str_size]), &value_size);
+        if (status != STRING_SUCCESS) goto errors;
+        (*str_size) += value_size;
+    }
+    else {
+        // Use local buffer at the end of the destination.
+        status = STRING_integer_to_string(value, format, print_prefix, str_value);
+        if (status != STRING_SUCCESS) goto errors;
+        status = STRING_append_string(str, str_size_max, str_value, str_size);
+        if (status != STRING_SUCCESS) goto errors;
+    }
+errors:
+    return status;
+}
+
+/*******************************************************************/
+STRING_status_t STRING_append_fixed_point(char_t* str, uint32_t str_size_max, int32_t value, uint8_t number_of_decimals, uint32_t* str_size) {
+    // Local variables.
+    STRING_status_t status = STRING_SUCCESS;
+    char_t field[STRING_FORMAT_FIELD_SIZE_MAX];
+    uint32_t field_idx = 0;
+    char_t sign = STRING_CHAR_NULL;
+    uint32_t abs_value = 0;
+    // Check parameters.
+    _STRING_check_pointer(str);
+    _STRING_check_pointer(str_size);
+    if (number_of_decimals >= MATH_U32_SIZE_DECIMAL_DIGITS) {
+        status = STRING_ERROR_NUMBER_OF_DIGITS_OVERFLOW;
+        goto errors;
+    }
+    if ((*str_size) > str_size_max) {
+        status = STRING_ERROR_APPEND_OVERFLOW;
+        goto errors;
+    }
+    // Convert absolute value.
+    if (value < 0) {
+        sign = STRING_CHAR_MINUS;
+    }
+    abs_value = (value < 0) ? (0 - (uint32_t) value) : ((uint32_t) value);
+    field_idx = _STRING_format_unsigned(abs_value, 10, STRING_HEXADECIMAL_LETTER_START, number_of_decimals, field);
+    status = _STRING_append_field(str, str_size_max, sign, &(field[field_idx]), (STRING_FORMAT_FIELD_SIZE_MAX - field_idx), 0, 0, STRING_CHAR_SPACE, str_size);
+errors:
+    return status;
+}
+
+/*******************************************************************/
+STRING_status_t STRING_append_integer_array(char_t* str, uint32_t str_size_max, void* data, STRING_array_type_t data_type, uint32_t data_size, STRING_format_t format, uint8_t print_prefix, char_t separator, uint32_t* str_size, uint32_t* data_index) {
+    // Local variables.
+    STRING_status_t status = STRING_SUCCESS;
+    char_t str_value[STRING_INTEGER_SIZE_MAX + 1];
+    char_t* str_ptr = NULL;
+    int32_t value = 0;
+    uint32_t value_size = 0;
+    uint32_t separator_size = 0;
+    uint32_t size = 0;
+    uint32_t idx = 0;
+    // Check parameters.
+    _STRING_check_pointer(str);
+    _STRING_check_pointer(data);
+    _STRING_check_pointer(str_size);
+    _STRING_check_pointer(data_index);
+    if (data_type >= STRING_ARRAY_TYPE_LAST) {
+        status = STRING_ERROR_ARRAY_TYPE;
+        goto errors;
+    }
+    if ((*str_size) > str_size_max) {
+        status = STRING_ERROR_APPEND_OVERFLOW;
+        goto errors;
+    }
+    size = (*str_size);
+    // Values loop.
+    for (idx = (*data_index); idx < data_size; idx++) {
+        // Read value.
+        switch (data_type) {
+        case STRING_ARRAY_TYPE_INT16:
+            value = (int32_t) (((int16_t*) data)[idx]);
+            break;
+        case STRING_ARRAY_TYPE_UINT16:
+            value = (int32_t) (((uint16_t*) data)[idx]);
+            break;
+        default:
+            value = ((int32_t*) data)[idx];
+            break;
+        }
+        separator_size = ((separator != STRING_CHAR_NULL) && (idx < (data_size - 1))) ? 1 : 0;
+        // Convert directly into the destination when the longest value fits, otherwise use local buffer.
+        str_ptr = ((str_size_max - size) > (STRING_INTEGER_SIZE_MAX + 1)) ? &(str[size]) : str_value;
+        status = _STRING_int32_to_string(value, format, print_prefix, str_ptr, &value_size);
+        if (status != STRING_SUCCESS) goto errors;
+        // Values are appended with their separator or not at all.
+        if ((value_size + separator_size) > (str_size_max - size)) {
+            status = STRING_ERROR_APPEND_OVERFLOW;
+            break;
+        }
+        if (str_ptr == str_value) {
+            for (value_size = 0; str_value[value_size] != STRING_CHAR_NULL; value_size++) {
+                str[size + value_size] = str_value[value_size];
+            }
+        }
+        size += value_size;
+        if (separator_size != 0) {
+            str[size++] = separator;
+        }
+    }
+    (*str_size) = size;
+    (*data_index) = idx;
 errors:
     return status;
 }
@@ -584,12 +2283,192 @@ errors:
 STRING_status_t STRING_append_byte_array(char_t* str, uint32_t str_size_max, uint8_t* data, uint32_t data_size_bytes, uint8_t print_prefix, uint32_t* str_size) {
     // Local variables.
     STRING_status_t status = STRING_SUCCESS;
-    char_t str_byte_array[STRING_VALUE_BUFFER_SIZE] = { STRING_CHAR_NULL };
-    // Convert byte array to hexadecimal string.
-    status = STRING_byte_array_to_hexadecimal_string(data, data_size_bytes, print_prefix, str_byte_array);
-    if (status != STRING_SUCCESS) goto errors;
-    // Add string.
-    status = STRING_append_string(str, str_size_max, str_byte_array, str_size);
+    uint32_t prefix_size = (print_prefix != 0) ? 2 : 0;
+    // Check parameters.
+    _STRING_check_pointer(str);
+    _STRING_check_pointer(data);
+    _STRING_check_pointer(str_size);
+    // Check space once for the whole array.
+    if (((*str_size) > str_size_max) || ((str_size_max - (*str_size)) < prefix_size) || (data_size_bytes > (((str_size_max - (*str_size)) - prefix_size) >> 1))) {
+        status = STRING_ERROR_APPEND_OVERFLOW;
+        goto errors;
+    }
+    // Print prefix once.
+    if (print_prefix != 0) {
+        str[(*str_size)++] = '0';
+        str[(*str_size)++] = 'x';
+    }
+    // Convert bytes directly into the destination.
+    _STRING_write_hexadecimal_bytes(data, data_size_bytes, &(str[*str_size]));
+    (*str_size) += (data_size_bytes << 1);
+errors:
+    return status;
+}
+
+/*******************************************************************/
+STRING_status_t STRING_append_format(char_t* str, uint32_t str_size_max, uint32_t* str_size, char_t* format, ...) {
+    // Local variables.
+    STRING_status_t status = STRING_SUCCESS;
+    va_list arguments;
+    // Process format.
+    va_start(arguments, format);
+    status = STRING_append_format_va(str, str_size_max, str_size, format, arguments);
+    va_end(arguments);
+    return status;
+}
+
+/*******************************************************************/
+STRING_status_t STRING_append_format_va(char_t* str, uint32_t str_size_max, uint32_t* str_size, char_t* format, va_list arguments) {
+    // Local variables.
+    STRING_status_t status = STRING_SUCCESS;
+    char_t field[STRING_FORMAT_FIELD_SIZE_MAX];
+    char_t* field_ptr = NULL;
+    uint32_t field_idx = 0;
+    uint32_t field_size = 0;
+    char_t sign = STRING_CHAR_NULL;
+    char_t padding_char = STRING_CHAR_SPACE;
+    uint8_t left_justify = 0;
+    uint8_t width = 0;
+    uint8_t precision = 0;
+    uint8_t precision_flag = 0;
+    uint8_t long_flag = 0;
+    int32_t signed_value = 0;
+    uint32_t unsigned_value = 0;
+    uint32_t idx = 0;
+    // Check parameters.
+    _STRING_check_pointer(str);
+    _STRING_check_pointer(str_size);
+    _STRING_check_pointer(format);
+    // Format loop.
+    while (format[idx] != STRING_CHAR_NULL) {
+        // Copy plain characters.
+        if (format[idx] != STRING_FORMAT_MARKER) {
+            status = _STRING_append_char(str, str_size_max, format[idx++], str_size);
+            if (status != STRING_SUCCESS) goto errors;
+            continue;
+        }
+        idx++;
+        // Reset specification.
+        sign = STRING_CHAR_NULL;
+        padding_char = STRING_CHAR_SPACE;
+        left_justify = 0;
+        width = 0;
+        precision = 0;
+        precision_flag = 0;
+        long_flag = 0;
+        // Flags.
+        while ((format[idx] == '-') || (format[idx] == '0')) {
+            if (format[idx] == '-') {
+                left_justify = 1;
+            }
+            else {
+                padding_char = '0';
+            }
+            idx++;
+        }
+        // Left justification is always padded with spaces.
+        if (left_justify != 0) {
+            padding_char = STRING_CHAR_SPACE;
+        }
+        // Width.
+        while ((format[idx] >= '0') && (format[idx] <= '9')) {
+            // Check overflow before accumulating the digit.
+            if (width > ((MATH_U8_MAX - (format[idx] - '0')) / 10)) {
+                status = STRING_ERROR_FORMAT;
+                goto errors;
+            }
+            width = (uint8_t) ((width * 10) + (format[idx++] - '0'));
+        }
+        // Precision.
+        if (format[idx] == STRING_CHAR_DOT) {
+            precision_flag = 1;
+            idx++;
+            while ((format[idx] >= '0') && (format[idx] <= '9')) {
+                // Check overflow before accumulating the digit.
+                if (precision > ((MATH_U8_MAX - (format[idx] - '0')) / 10)) {
+                    status = STRING_ERROR_FORMAT;
+                    goto errors;
+                }
+                precision = (uint8_t) ((precision * 10) + (format[idx++] - '0'));
+            }
+        }
+        // Length modifier.
+        if (format[idx] == 'l') {
+            long_flag = 1;
+            idx++;
+        }
+        // Conversion.
+        switch (format[idx]) {
+        case 'd':
+        case 'i':
+            signed_value = (long_flag != 0) ? (int32_t) va_arg(arguments, long) : (int32_t) va_arg(arguments, int);
+            if (signed_value < 0) {
+                sign = STRING_CHAR_MINUS;
+            }
+            unsigned_value = (signed_value < 0) ? (0 - (uint32_t) signed_value) : ((uint32_t) signed_value);
+            field_idx = _STRING_format_unsigned(unsigned_value, 10, STRING_HEXADECIMAL_LETTER_START, 0, field);
+            break;
+        case 'u':
+        case 'x':
+        case 'X':
+            unsigned_value = (long_flag != 0) ? (uint32_t) va_arg(arguments, unsigned long) : (uint32_t) va_arg(arguments, unsigned int);
+            if (format[idx] == 'u') {
+                field_idx = _STRING_format_unsigned(unsigned_value, 10, STRING_HEXADECIMAL_LETTER_START, 0, field);
+            }
+            else {
+                field_idx = _STRING_format_unsigned(unsigned_value, 16, ((format[idx] == 'X') ? 'A' : 'a'), 0, field);
+            }
+            break;
+        case 'c':
+            field[0] = (char_t) va_arg(arguments, int);
+            field_ptr = field;
+            field_size = 1;
+            break;
+        case 's':
+            field_ptr = va_arg(arguments, char_t*);
+            _STRING_check_pointer(field_ptr);
+            status = STRING_get_size(field_ptr, &field_size);
+            if (status != STRING_SUCCESS) goto errors;
+            // Precision gives the maximum number of characters.
+            if ((precision_flag != 0) && (field_size > precision)) {
+                field_size = precision;
+            }
+            break;
+        case STRING_FORMAT_MARKER:
+            field[0] = STRING_FORMAT_MARKER;
+            field_ptr = field;
+            field_size = 1;
+            break;
+        default:
+            status = STRING_ERROR_FORMAT;
+            goto errors;
+        }
+        // Precision gives the minimum number of digits of integers, in which case the '0' flag is ignored.
+        if ((format[idx] == 'd') || (format[idx] == 'i') || (format[idx] == 'u') || (format[idx] == 'x') || (format[idx] == 'X')) {
+            if (precision_flag != 0) {
+                if (precision > MATH_U32_SIZE_DECIMAL_DIGITS) {
+                    status = STRING_ERROR_FORMAT;
+                    goto errors;
+                }
+                // A zero value with zero precision prints no digit.
+                if ((precision == 0) && (unsigned_value == 0)) {
+                    field_idx = STRING_FORMAT_FIELD_SIZE_MAX;
+                }
+                while ((STRING_FORMAT_FIELD_SIZE_MAX - field_idx) < precision) {
+                    field[--field_idx] = '0';
+                }
+                if (left_justify == 0) {
+                    padding_char = STRING_CHAR_SPACE;
+                }
+            }
+            field_ptr = &(field[field_idx]);
+            field_size = (STRING_FORMAT_FIELD_SIZE_MAX - field_idx);
+        }
+        idx++;
+        // Print field.
+        status = _STRING_append_field(str, str_size_max, sign, field_ptr, field_size, width, left_justify, padding_char, str_size);
+        if (status != STRING_SUCCESS) goto errors;
+    }
 errors:
     return status;
 }
@@ -10,6 +10,7 @@
 #ifndef EMBEDDED_UTILS_DISABLE_FLAGS_FILE
 #include "embedded_utils_flags.h"
 #endif
+#include "cobs.h"
 #include "error.h"
 #include "terminal_hw.h"
 #include "strings.h"
@@ -17,16 +18,58 @@
 
 #if (!(defined EMBEDDED_UTILS_TERMINAL_DRIVER_DISABLE) && (EMBEDDED_UTILS_TERMINAL_INSTANCES_NUMBER > 0))
 
+/*** TERMINAL local macros ***/
+
+#if ((defined EMBEDDED_UTILS_TERMINAL_MODE_BUS) && (defined EMBEDDED_UTILS_TERMINAL_BUS_QUEUE_SIZE))
+#define TERMINAL_BUS_QUEUE_HEADER_SIZE  3
+#endif
+
+#ifdef EMBEDDED_UTILS_TERMINAL_FLOW_CONTROL
+#define TERMINAL_CHAR_XON               0x11
+#define TERMINAL_CHAR_XOFF              0x13
+#endif
+
+#ifdef EMBEDDED_UTILS_TERMINAL_STATISTICS
+#define _TERMINAL_update_buffer_statistics(instance, status) { _TERMINAL_compute_buffer_statistics(instance, status); }
+#else
+#define _TERMINAL_update_buffer_statistics(instance, status) { }
+#endif
+
 /*** TERMINAL local structures ***/
 
 /*******************************************************************/
 typedef struct {
-    char_t buffer[EMBEDDED_UTILS_TERMINAL_BUFFER_SIZE];
+    char_t* buffer;
+    uint32_t buffer_size_max;
     uint32_t buffer_size;
+#if ((defined EMBEDDED_UTILS_TERMINAL_MODE_BUS) && (defined EMBEDDED_UTILS_TERMINAL_BUS_QUEUE_SIZE))
+    uint32_t queue_size;
+#endif
+#ifdef EMBEDDED_UTILS_TERMINAL_STATISTICS
+    TERMINAL_statistics_t statistics;
+#endif
+#ifdef EMBEDDED_UTILS_TERMINAL_FLOW_CONTROL
+    TERMINAL_flow_control_t flow_control;
+    uint32_t rx_level_high;
+    uint32_t rx_level_low;
+    volatile uint8_t rx_stopped;
+    volatile uint8_t rx_stopped_sent;
+    uint8_t flow_char_deferred;
+#endif
+#ifdef EMBEDDED_UTILS_TERMINAL_HALF_DUPLEX
+    volatile uint8_t rx_enabled;
+    volatile uint8_t tx_pending;
+#endif
 } TERMINAL_context_t;
 
 /*** TERMINAL local global variables ***/
 
+#ifdef EMBEDDED_UTILS_TERMINAL_BUFFER_SIZE
+static char_t terminal_buffer[EMBEDDED_UTILS_TERMINAL_INSTANCES_NUMBER][EMBEDDED_UTILS_TERMINAL_BUFFER_SIZE];
+#endif
+#if ((defined EMBEDDED_UTILS_TERMINAL_MODE_BUS) && (defined EMBEDDED_UTILS_TERMINAL_BUS_QUEUE_SIZE))
+static uint8_t terminal_bus_queue[EMBEDDED_UTILS_TERMINAL_INSTANCES_NUMBER][EMBEDDED_UTILS_TERMINAL_BUS_QUEUE_SIZE];
+#endif
 static TERMINAL_context_t terminal_ctx[EMBEDDED_UTILS_TERMINAL_INSTANCES_NUMBER];
 
 /*** TERMINAL local functions ***/
@@ -39,12 +82,192 @@ static TERMINAL_context_t terminal_ctx[EMBEDDED_UTILS_TERMINAL_INSTANCES_NUMBER]
     } \
 }
 
+#ifdef EMBEDDED_UTILS_TERMINAL_STATISTICS
+/*******************************************************************/
+static void _TERMINAL_compute_buffer_statistics(uint8_t instance, TERMINAL_status_t status) {
+    // Local variables.
+    TERMINAL_statistics_t* statistics = NULL;
+    // Check instance.
+    if (instance >= EMBEDDED_UTILS_TERMINAL_INSTANCES_NUMBER) goto errors;
+    statistics = &(terminal_ctx[instance].statistics);
+    // Update high water mark.
+    if (terminal_ctx[instance].buffer_size > (statistics->tx_buffer_high_water_mark)) {
+        (statistics->tx_buffer_high_water_mark) = terminal_ctx[instance].buffer_size;
+    }
+    // Count data which did not fit in the buffer.
+    if ((status == TERMINAL_ERROR_TX_BUFFER_OVERFLOW) || (status == (TERMINAL_ERROR_BASE_STRING + STRING_ERROR_APPEND_OVERFLOW)) || (status == (TERMINAL_ERROR_BASE_COBS + COBS_ERROR_ENCODING_OVERFLOW))) {
+        (statistics->tx_buffer_overflow_count)++;
+    }
+errors:
+    return;
+}
+#endif
+
+#ifdef EMBEDDED_UTILS_TERMINAL_HALF_DUPLEX
+/*******************************************************************/
+static void _TERMINAL_tx_complete_irq_callback(uint8_t instance) {
+    // Check instance.
+    if (instance >= EMBEDDED_UTILS_TERMINAL_INSTANCES_NUMBER) goto errors;
+    // Release the line.
+    TERMINAL_HW_set_driver_enable(instance, 0);
+    terminal_ctx[instance].tx_pending = 0;
+    // Re-enable receiver if it has been requested (flag must be read after clearing the TX pending flag).
+    if (terminal_ctx[instance].rx_enabled != 0) {
+        TERMINAL_HW_enable_rx(instance);
+    }
+errors:
+    return;
+}
+
+/*******************************************************************/
+static TERMINAL_status_t _TERMINAL_line_write(uint8_t instance, uint8_t* data, uint32_t data_size_bytes) {
+    // Local variables.
+    TERMINAL_status_t status = TERMINAL_SUCCESS;
+    TERMINAL_status_t irq_status = TERMINAL_SUCCESS;
+    // Mute receiver during transmission.
+    terminal_ctx[instance].tx_pending = 1;
+    if (terminal_ctx[instance].rx_enabled != 0) {
+        status = TERMINAL_HW_disable_rx(instance);
+        if (status != TERMINAL_SUCCESS) goto errors;
+    }
+    // Take the line.
+    status = TERMINAL_HW_set_driver_enable(instance, 1);
+    if ((status != TERMINAL_SUCCESS) && (status != TERMINAL_ERROR_HW_FUNCTION_NOT_IMPLEMENTED)) goto errors;
+    // Write data.
+    status = TERMINAL_HW_write(instance, data, data_size_bytes);
+    if (status != TERMINAL_SUCCESS) goto errors;
+    // Turnaround is performed when the last stop bit has been sent.
+    irq_status = TERMINAL_HW_enable_tx_complete_irq(instance, &_TERMINAL_tx_complete_irq_callback);
+errors:
+    // Turnaround immediately if the transmission complete interrupt has not been armed.
+    if ((status != TERMINAL_SUCCESS) || (irq_status != TERMINAL_SUCCESS)) {
+        _TERMINAL_tx_complete_irq_callback(instance);
+    }
+    return status;
+}
+#else
+#define _TERMINAL_line_write(instance, data, data_size_bytes) TERMINAL_HW_write(instance, data, data_size_bytes)
+#endif
+
+#ifdef EMBEDDED_UTILS_TERMINAL_FLOW_CONTROL
+/*******************************************************************/
+static TERMINAL_status_t _TERMINAL_set_rx_flow(uint8_t instance, uint8_t rx_allowed) {
+    // Local variables.
+    TERMINAL_status_t status = TERMINAL_SUCCESS;
+    uint8_t flow_char = (rx_allowed != 0) ? TERMINAL_CHAR_XON : TERMINAL_CHAR_XOFF;
+    // Drive the hardware line.
+    if (terminal_ctx[instance].flow_control == TERMINAL_FLOW_CONTROL_HARDWARE) {
+        status = TERMINAL_HW_set_rts(instance, rx_allowed);
+    }
+    // Write the control character immediately, even if the main context is busy.
+    if ((terminal_ctx[instance].flow_control == TERMINAL_FLOW_CONTROL_SOFTWARE) && (terminal_ctx[instance].flow_char_deferred == 0)) {
+        status = TERMINAL_HW_write_control_char(instance, flow_char);
+        if (status == TERMINAL_SUCCESS) {
+            terminal_ctx[instance].rx_stopped_sent = (rx_allowed == 0) ? 1 : 0;
+        }
+        else if (status == TERMINAL_ERROR_HW_FUNCTION_NOT_IMPLEMENTED) {
+            // Fall back on the TX path, the character is sent by the main context according to the rx_stopped flag.
+            terminal_ctx[instance].flow_char_deferred = 1;
+            status = TERMINAL_SUCCESS;
+        }
+    }
+    return status;
+}
+
+/*******************************************************************/
+static TERMINAL_status_t _TERMINAL_send_flow_char(uint8_t instance) {
+    // Local variables.
+    TERMINAL_status_t status = TERMINAL_SUCCESS;
+    uint8_t rx_stopped = terminal_ctx[instance].rx_stopped;
+    uint8_t flow_char = (rx_stopped != 0) ? TERMINAL_CHAR_XOFF : TERMINAL_CHAR_XON;
+    // Check if the control character is deferred and if the sender state has changed since the last one.
+    if ((terminal_ctx[instance].flow_control != TERMINAL_FLOW_CONTROL_SOFTWARE) || (terminal_ctx[instance].flow_char_deferred == 0) || (rx_stopped == terminal_ctx[instance].rx_stopped_sent)) goto errors;
+    // Control characters bypass the TX buffer which may contain a message being built.
+    status = _TERMINAL_line_write(instance, &flow_char, 1);
+    if (status != TERMINAL_SUCCESS) goto errors;
+    // The flag is only written by the main context, a request received in between is sent on next call.
+    terminal_ctx[instance].rx_stopped_sent = rx_stopped;
+errors:
+    return status;
+}
+#endif
+
+/*******************************************************************/
+static TERMINAL_status_t _TERMINAL_hw_write(uint8_t instance, uint8_t* data, uint32_t data_size_bytes) {
+    // Local variables.
+    TERMINAL_status_t status = TERMINAL_SUCCESS;
+#ifdef EMBEDDED_UTILS_TERMINAL_STATISTICS
+    TERMINAL_statistics_t* statistics = &(terminal_ctx[instance].statistics);
+    TERMINAL_status_t timestamp_status = TERMINAL_SUCCESS;
+    uint32_t write_start = 0;
+    uint32_t write_end = 0;
+    // Timestamp function is optional.
+    timestamp_status = TERMINAL_HW_get_timestamp(&write_start);
+#endif
+    // Write data.
+    status = _TERMINAL_line_write(instance, data, data_size_bytes);
+#ifdef EMBEDDED_UTILS_TERMINAL_STATISTICS
+    // Update counters.
+    (statistics->tx_write_count)++;
+    if (status == TERMINAL_SUCCESS) {
+        (statistics->tx_bytes_count) += data_size_bytes;
+    }
+    if ((timestamp_status == TERMINAL_SUCCESS) && (TERMINAL_HW_get_timestamp(&write_end) == TERMINAL_SUCCESS)) {
+        (statistics->tx_blocked_time) += (write_end - write_start);
+    }
+#endif
+    return status;
+}
+
 /*** TERMINAL functions ***/
 
 /*******************************************************************/
+#ifdef EMBEDDED_UTILS_TERMINAL_BUFFER_SIZE
 TERMINAL_status_t TERMINAL_open(uint8_t instance, uint32_t baud_rate, TERMINAL_rx_irq_cb_t rx_irq_callback) {
+#else
+TERMINAL_status_t TERMINAL_open(uint8_t instance, uint32_t baud_rate, char_t* tx_buffer, uint32_t tx_buffer_size, TERMINAL_rx_irq_cb_t rx_irq_callback) {
+#endif
     // Local variables.
     TERMINAL_status_t status = TERMINAL_SUCCESS;
+    // Check instance.
+    _TERMINAL_check_instance(instance);
+    // Attach TX buffer.
+#ifdef EMBEDDED_UTILS_TERMINAL_BUFFER_SIZE
+    terminal_ctx[instance].buffer = terminal_buffer[instance];
+    terminal_ctx[instance].buffer_size_max = EMBEDDED_UTILS_TERMINAL_BUFFER_SIZE;
+#else
+    if (tx_buffer == NULL) {
+        status = TERMINAL_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    if (tx_buffer_size == 0) {
+        status = TERMINAL_ERROR_TX_BUFFER_SIZE;
+        goto errors;
+    }
+    terminal_ctx[instance].buffer = tx_buffer;
+    terminal_ctx[instance].buffer_size_max = tx_buffer_size;
+#endif
+#if ((defined EMBEDDED_UTILS_TERMINAL_MODE_BUS) && (defined EMBEDDED_UTILS_TERMINAL_BUS_QUEUE_SIZE))
+    // Reset queue.
+    terminal_ctx[instance].queue_size = 0;
+#endif
+#ifdef EMBEDDED_UTILS_TERMINAL_STATISTICS
+    // Reset statistics.
+    status = TERMINAL_reset_statistics(instance);
+    if (status != TERMINAL_SUCCESS) goto errors;
+#endif
+#ifdef EMBEDDED_UTILS_TERMINAL_FLOW_CONTROL
+    // Disable flow control.
+    terminal_ctx[instance].flow_control = TERMINAL_FLOW_CONTROL_NONE;
+    terminal_ctx[instance].flow_char_deferred = 0;
+    terminal_ctx[instance].rx_stopped = 0;
+    terminal_ctx[instance].rx_stopped_sent = 0;
+#endif
+#ifdef EMBEDDED_UTILS_TERMINAL_HALF_DUPLEX
+    // Receiver is disabled after hardware initialization.
+    terminal_ctx[instance].rx_enabled = 0;
+    terminal_ctx[instance].tx_pending = 0;
+#endif
     // Flush buffer.
     status = TERMINAL_flush_tx_buffer(instance);
     if (status != TERMINAL_SUCCESS) goto errors;
@@ -74,6 +297,11 @@ TERMINAL_status_t TERMINAL_enable_rx(uint8_t instance) {
     TERMINAL_status_t status = TERMINAL_SUCCESS;
     // Check instance.
     _TERMINAL_check_instance(instance);
+#ifdef EMBEDDED_UTILS_TERMINAL_HALF_DUPLEX
+    // Receiver will be enabled by the transmission complete interrupt if a transmission is pending.
+    terminal_ctx[instance].rx_enabled = 1;
+    if (terminal_ctx[instance].tx_pending != 0) goto errors;
+#endif
     // Release hardware interface.
     status = TERMINAL_HW_enable_rx(instance);
     if (status != TERMINAL_SUCCESS) goto errors;
@@ -87,6 +315,9 @@ TERMINAL_status_t TERMINAL_disable_rx(uint8_t instance) {
     TERMINAL_status_t status = TERMINAL_SUCCESS;
     // Check instance.
     _TERMINAL_check_instance(instance);
+#ifdef EMBEDDED_UTILS_TERMINAL_HALF_DUPLEX
+    terminal_ctx[instance].rx_enabled = 0;
+#endif
     // Release hardware interface.
     status = TERMINAL_HW_disable_rx(instance);
     if (status != TERMINAL_SUCCESS) goto errors;
@@ -102,7 +333,7 @@ TERMINAL_status_t TERMINAL_flush_tx_buffer(uint8_t instance) {
     // Check instance.
     _TERMINAL_check_instance(instance);
     // Flush buffer.
-    for (idx = 0; idx < EMBEDDED_UTILS_TERMINAL_BUFFER_SIZE; idx++) {
+    for (idx = 0; idx < terminal_ctx[instance].buffer_size_max; idx++) {
         terminal_ctx[instance].buffer[idx] = 0;
     }
     terminal_ctx[instance].buffer_size = 0;
@@ -118,10 +349,26 @@ TERMINAL_status_t TERMINAL_tx_buffer_add_string(uint8_t instance, char_t* str) {
     // Check instance.
     _TERMINAL_check_instance(instance);
     // Get size.
-    string_status = STRING_append_string(terminal_ctx[instance].buffer, EMBEDDED_UTILS_TERMINAL_BUFFER_SIZE, str, &(terminal_ctx[instance].buffer_size));
+    string_status = STRING_append_string(terminal_ctx[instance].buffer, terminal_ctx[instance].buffer_size_max, str, &(terminal_ctx[instance].buffer_size));
     STRING_exit_error(TERMINAL_ERROR_BASE_STRING);
 
 errors:
+    _TERMINAL_update_buffer_statistics(instance, status);
+    return status;
+}
+
+/*******************************************************************/
+TERMINAL_status_t TERMINAL_tx_buffer_add_view(uint8_t instance, STRING_view_t view) {
+    // Local variables.
+    TERMINAL_status_t status = TERMINAL_SUCCESS;
+    STRING_status_t string_status = STRING_SUCCESS;
+    // Check instance.
+    _TERMINAL_check_instance(instance);
+    // Append view.
+    string_status = STRING_append_view(terminal_ctx[instance].buffer, terminal_ctx[instance].buffer_size_max, view, &(terminal_ctx[instance].buffer_size));
+    STRING_exit_error(TERMINAL_ERROR_BASE_STRING);
+errors:
+    _TERMINAL_update_buffer_statistics(instance, status);
     return status;
 }
 
@@ -133,9 +380,36 @@ TERMINAL_status_t TERMINAL_tx_buffer_add_integer(uint8_t instance, int32_t value
     // Check instance.
     _TERMINAL_check_instance(instance);
     // Convert to string.
-    string_status = STRING_append_integer(terminal_ctx[instance].buffer, EMBEDDED_UTILS_TERMINAL_BUFFER_SIZE, value, format, print_prefix, &(terminal_ctx[instance].buffer_size));
+    string_status = STRING_append_integer(terminal_ctx[instance].buffer, terminal_ctx[instance].buffer_size_max, value, format, print_prefix, &(terminal_ctx[instance].buffer_size));
+    STRING_exit_error(TERMINAL_ERROR_BASE_STRING);
+errors:
+    _TERMINAL_update_buffer_statistics(instance, status);
+    return status;
+}
+
+/*******************************************************************/
+TERMINAL_status_t TERMINAL_tx_buffer_add_integer_array(uint8_t instance, void* data, STRING_array_type_t data_type, uint32_t data_size, STRING_format_t format, uint8_t print_prefix, char_t separator) {
+    // Local variables.
+    TERMINAL_status_t status = TERMINAL_SUCCESS;
+    STRING_status_t string_status = STRING_SUCCESS;
+    uint32_t data_index = 0;
+    // Check instance.
+    _TERMINAL_check_instance(instance);
+    // Convert values.
+    while (1) {
+        string_status = STRING_append_integer_array(terminal_ctx[instance].buffer, terminal_ctx[instance].buffer_size_max, data, data_type, data_size, format, print_prefix, separator, &(terminal_ctx[instance].buffer_size), &data_index);
+        // Exit if all values have been appended or if a value does not fit in an empty buffer.
+        if ((string_status != STRING_ERROR_APPEND_OVERFLOW) || (terminal_ctx[instance].buffer_size == 0)) break;
+        // Send full buffer and continue from the first value which did not fit.
+        _TERMINAL_update_buffer_statistics(instance, status);
+        status = TERMINAL_send_tx_buffer(instance);
+        if (status != TERMINAL_SUCCESS) goto errors;
+        status = TERMINAL_flush_tx_buffer(instance);
+        if (status != TERMINAL_SUCCESS) goto errors;
+    }
     STRING_exit_error(TERMINAL_ERROR_BASE_STRING);
 errors:
+    _TERMINAL_update_buffer_statistics(instance, status);
     return status;
 }
 
@@ -147,20 +421,118 @@ TERMINAL_status_t TERMINAL_tx_buffer_add_byte_array(uint8_t instance, uint8_t* d
     // Check instance.
     _TERMINAL_check_instance(instance);
     // Convert to string.
-    string_status = STRING_append_byte_array(terminal_ctx[instance].buffer, EMBEDDED_UTILS_TERMINAL_BUFFER_SIZE, data, data_size_bytes, print_prefix, &(terminal_ctx[instance].buffer_size));
+    string_status = STRING_append_byte_array(terminal_ctx[instance].buffer, terminal_ctx[instance].buffer_size_max, data, data_size_bytes, print_prefix, &(terminal_ctx[instance].buffer_size));
     STRING_exit_error(TERMINAL_ERROR_BASE_STRING);
 errors:
+    _TERMINAL_update_buffer_statistics(instance, status);
     return status;
 }
 
+/*******************************************************************/
+TERMINAL_status_t TERMINAL_tx_buffer_add_data(uint8_t instance, uint8_t* data, uint32_t data_size_bytes) {
+    // Local variables.
+    TERMINAL_status_t status = TERMINAL_SUCCESS;
+    uint32_t idx = 0;
+    // Check instance.
+    _TERMINAL_check_instance(instance);
+    // Check parameters.
+    if (data == NULL) {
+        status = TERMINAL_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    if (data_size_bytes > (terminal_ctx[instance].buffer_size_max - terminal_ctx[instance].buffer_size)) {
+        status = TERMINAL_ERROR_TX_BUFFER_OVERFLOW;
+        goto errors;
+    }
+    // Copy bytes.
+    for (idx = 0; idx < data_size_bytes; idx++) {
+        terminal_ctx[instance].buffer[terminal_ctx[instance].buffer_size + idx] = (char_t) data[idx];
+    }
+    terminal_ctx[instance].buffer_size += data_size_bytes;
+errors:
+    _TERMINAL_update_buffer_statistics(instance, status);
+    return status;
+}
+
+/*******************************************************************/
+TERMINAL_status_t TERMINAL_tx_buffer_add_format(uint8_t instance, char_t* format, ...) {
+    // Local variables.
+    TERMINAL_status_t status = TERMINAL_SUCCESS;
+    va_list arguments;
+    // Process format.
+    va_start(arguments, format);
+    status = TERMINAL_tx_buffer_add_format_va(instance, format, arguments);
+    va_end(arguments);
+    return status;
+}
+
+/*******************************************************************/
+TERMINAL_status_t TERMINAL_tx_buffer_add_format_va(uint8_t instance, char_t* format, va_list arguments) {
+    // Local variables.
+    TERMINAL_status_t status = TERMINAL_SUCCESS;
+    STRING_status_t string_status = STRING_SUCCESS;
+    // Check instance.
+    _TERMINAL_check_instance(instance);
+    // Format directly into the buffer.
+    string_status = STRING_append_format_va(terminal_ctx[instance].buffer, terminal_ctx[instance].buffer_size_max, &(terminal_ctx[instance].buffer_size), format, arguments);
+    STRING_exit_error(TERMINAL_ERROR_BASE_STRING);
+errors:
+    _TERMINAL_update_buffer_statistics(instance, status);
+    return status;
+}
+
+#ifndef EMBEDDED_UTILS_COBS_DRIVER_DISABLE
+/*******************************************************************/
+TERMINAL_status_t TERMINAL_tx_buffer_add_cobs_frame(uint8_t instance, uint8_t* data, uint32_t data_size_bytes) {
+    // Local variables.
+    TERMINAL_status_t status = TERMINAL_SUCCESS;
+    COBS_status_t cobs_status = COBS_SUCCESS;
+    // Check instance.
+    _TERMINAL_check_instance(instance);
+    // Encode directly into the buffer.
+    cobs_status = COBS_encode((uint8_t*) terminal_ctx[instance].buffer, terminal_ctx[instance].buffer_size_max, data, data_size_bytes, &(terminal_ctx[instance].buffer_size));
+    COBS_exit_error(TERMINAL_ERROR_BASE_COBS);
+errors:
+    _TERMINAL_update_buffer_statistics(instance, status);
+    return status;
+}
+#endif
+
 /*******************************************************************/
 TERMINAL_status_t TERMINAL_send_tx_buffer(uint8_t instance) {
     // Local variables.
     TERMINAL_status_t status = TERMINAL_SUCCESS;
     // Check instance.
     _TERMINAL_check_instance(instance);
+#ifdef EMBEDDED_UTILS_TERMINAL_FLOW_CONTROL
+    // Send pending control character first.
+    status = _TERMINAL_send_flow_char(instance);
+    if (status != TERMINAL_SUCCESS) goto errors;
+#endif
     // Print message.
-    status = TERMINAL_HW_write(instance, ((uint8_t*) terminal_ctx[instance].buffer), terminal_ctx[instance].buffer_size);
+    status = _TERMINAL_hw_write(instance, ((uint8_t*) terminal_ctx[instance].buffer), terminal_ctx[instance].buffer_size);
+    if (status != TERMINAL_SUCCESS) goto errors;
+errors:
+    return status;
+}
+
+/*******************************************************************/
+TERMINAL_status_t TERMINAL_send_data(uint8_t instance, uint8_t* data, uint32_t data_size_bytes) {
+    // Local variables.
+    TERMINAL_status_t status = TERMINAL_SUCCESS;
+    // Check parameters.
+    _TERMINAL_check_instance(instance);
+    if (data == NULL) {
+        status = TERMINAL_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+#ifdef EMBEDDED_UTILS_TERMINAL_FLOW_CONTROL
+    // Send pending control character first.
+    status = _TERMINAL_send_flow_char(instance);
+    if (status != TERMINAL_SUCCESS) goto errors;
+#endif
+    // Write data without using the TX buffer.
+    status = _TERMINAL_hw_write(instance, data, data_size_bytes);
     if (status != TERMINAL_SUCCESS) goto errors;
 errors:
     return status;
@@ -181,4 +553,218 @@ errors:
 }
 #endif
 
+#if ((defined EMBEDDED_UTILS_TERMINAL_MODE_BUS) && (defined EMBEDDED_UTILS_TERMINAL_BUS_QUEUE_SIZE))
+/*******************************************************************/
+TERMINAL_status_t TERMINAL_queue_tx_buffer(uint8_t instance, uint8_t destination_address) {
+    // Local variables.
+    TERMINAL_status_t status = TERMINAL_SUCCESS;
+    uint8_t* queue = NULL;
+    uint32_t queue_size = 0;
+    uint32_t idx = 0;
+    // Check instance.
+    _TERMINAL_check_instance(instance);
+    queue = terminal_bus_queue[instance];
+    queue_size = terminal_ctx[instance].queue_size;
+    // Check free space.
+    if ((terminal_ctx[instance].buffer_size + TERMINAL_BUS_QUEUE_HEADER_SIZE) > (EMBEDDED_UTILS_TERMINAL_BUS_QUEUE_SIZE - queue_size)) {
+        status = TERMINAL_ERROR_TX_QUEUE_FULL;
+        goto errors;
+    }
+    // Write record header.
+    queue[queue_size++] = destination_address;
+    queue[queue_size++] = (uint8_t) ((terminal_ctx[instance].buffer_size >> 8) & 0xFF);
+    queue[queue_size++] = (uint8_t) ((terminal_ctx[instance].buffer_size >> 0) & 0xFF);
+    // Copy message.
+    for (idx = 0; idx < terminal_ctx[instance].buffer_size; idx++) {
+        queue[queue_size++] = (uint8_t) terminal_ctx[instance].buffer[idx];
+    }
+    terminal_ctx[instance].queue_size = queue_size;
+    // Flush buffer.
+    status = TERMINAL_flush_tx_buffer(instance);
+    if (status != TERMINAL_SUCCESS) goto errors;
+errors:
+    return status;
+}
+
+/*******************************************************************/
+TERMINAL_status_t TERMINAL_send_tx_queue(uint8_t instance) {
+    // Local variables.
+    TERMINAL_status_t status = TERMINAL_SUCCESS;
+    uint8_t* queue = NULL;
+    uint32_t queue_size = 0;
+    uint32_t read_idx = 0;
+    uint32_t write_idx = 0;
+    uint32_t record_size = 0;
+    uint32_t idx = 0;
+    uint8_t destination_address = 0;
+    // Check instance.
+    _TERMINAL_check_instance(instance);
+    queue = terminal_bus_queue[instance];
+    queue_size = terminal_ctx[instance].queue_size;
+#ifdef EMBEDDED_UTILS_TERMINAL_FLOW_CONTROL
+    // Send pending control character first.
+    status = _TERMINAL_send_flow_char(instance);
+    if (status != TERMINAL_SUCCESS) goto end;
+#endif
+    // Groups loop.
+    while (queue_size > 0) {
+        // The first remaining record gives the address of the group.
+        destination_address = queue[0];
+        status = TERMINAL_HW_set_destination_address(instance, destination_address);
+        if (status != TERMINAL_SUCCESS) goto end;
+        // Send all records of the group and compact the other ones at the beginning of the queue.
+        read_idx = 0;
+        write_idx = 0;
+        while (read_idx < queue_size) {
+            record_size = TERMINAL_BUS_QUEUE_HEADER_SIZE + (((uint32_t) queue[read_idx + 1]) << 8) + ((uint32_t) queue[read_idx + 2]);
+            if (queue[read_idx] == destination_address) {
+                status = _TERMINAL_hw_write(instance, &(queue[read_idx + TERMINAL_BUS_QUEUE_HEADER_SIZE]), (record_size - TERMINAL_BUS_QUEUE_HEADER_SIZE));
+                if (status != TERMINAL_SUCCESS) goto end;
+            }
+            else {
+                if (write_idx != read_idx) {
+                    for (idx = 0; idx < record_size; idx++) {
+                        queue[write_idx + idx] = queue[read_idx + idx];
+                    }
+                }
+                write_idx += record_size;
+            }
+            read_idx += record_size;
+        }
+        queue_size = write_idx;
+    }
+end:
+    // Queue is always emptied.
+    terminal_ctx[instance].queue_size = 0;
+errors:
+    return status;
+}
+#endif
+
+#ifdef EMBEDDED_UTILS_TERMINAL_STATISTICS
+/*******************************************************************/
+TERMINAL_status_t TERMINAL_get_statistics(uint8_t instance, TERMINAL_statistics_t* statistics) {
+    // Local variables.
+    TERMINAL_status_t status = TERMINAL_SUCCESS;
+    // Check parameters.
+    _TERMINAL_check_instance(instance);
+    if (statistics == NULL) {
+        status = TERMINAL_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    // Copy counters.
+    (*statistics) = terminal_ctx[instance].statistics;
+    (statistics->tx_buffer_size_max) = terminal_ctx[instance].buffer_size_max;
+errors:
+    return status;
+}
+
+/*******************************************************************/
+TERMINAL_status_t TERMINAL_reset_statistics(uint8_t instance) {
+    // Local variables.
+    TERMINAL_status_t status = TERMINAL_SUCCESS;
+    // Check instance.
+    _TERMINAL_check_instance(instance);
+    // Reset counters.
+    terminal_ctx[instance].statistics.tx_bytes_count = 0;
+    terminal_ctx[instance].statistics.tx_write_count = 0;
+    terminal_ctx[instance].statistics.tx_buffer_size_max = 0;
+    terminal_ctx[instance].statistics.tx_buffer_high_water_mark = 0;
+    terminal_ctx[instance].statistics.tx_buffer_overflow_count = 0;
+    terminal_ctx[instance].statistics.tx_blocked_time = 0;
+errors:
+    return status;
+}
+
+/*******************************************************************/
+TERMINAL_status_t TERMINAL_get_timestamp(uint32_t* timestamp) {
+    // Local variables.
+    TERMINAL_status_t status = TERMINAL_SUCCESS;
+    // Check parameter.
+    if (timestamp == NULL) {
+        status = TERMINAL_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    // Read hardware timestamp.
+    status = TERMINAL_HW_get_timestamp(timestamp);
+    if (status != TERMINAL_SUCCESS) goto errors;
+errors:
+    return status;
+}
+#endif
+
+#ifdef EMBEDDED_UTILS_TERMINAL_FLOW_CONTROL
+/*******************************************************************/
+TERMINAL_status_t TERMINAL_configure_flow_control(uint8_t instance, TERMINAL_flow_control_t flow_control, uint32_t rx_level_high, uint32_t rx_level_low) {
+    // Local variables.
+    TERMINAL_status_t status = TERMINAL_SUCCESS;
+    // Check parameters.
+    _TERMINAL_check_instance(instance);
+    if (flow_control >= TERMINAL_FLOW_CONTROL_LAST) {
+        status = TERMINAL_ERROR_FLOW_CONTROL;
+        goto errors;
+    }
+    if ((flow_control != TERMINAL_FLOW_CONTROL_NONE) && (rx_level_low >= rx_level_high)) {
+        status = TERMINAL_ERROR_FLOW_CONTROL_LEVEL;
+        goto errors;
+    }
+    // Release sender before switching mode.
+    if (terminal_ctx[instance].rx_stopped != 0) {
+        terminal_ctx[instance].rx_stopped = 0;
+        status = _TERMINAL_set_rx_flow(instance, 1);
+        if (status != TERMINAL_SUCCESS) goto errors;
+    }
+    status = _TERMINAL_send_flow_char(instance);
+    if (status != TERMINAL_SUCCESS) goto errors;
+    terminal_ctx[instance].rx_stopped_sent = 0;
+    // Update configuration.
+    terminal_ctx[instance].flow_control = flow_control;
+    terminal_ctx[instance].rx_level_high = rx_level_high;
+    terminal_ctx[instance].rx_level_low = rx_level_low;
+    // Allow reception on hardware line.
+    if (flow_control == TERMINAL_FLOW_CONTROL_HARDWARE) {
+        status = _TERMINAL_set_rx_flow(instance, 1);
+        if (status != TERMINAL_SUCCESS) goto errors;
+    }
+errors:
+    return status;
+}
+
+/*******************************************************************/
+TERMINAL_status_t TERMINAL_update_rx_level(uint8_t instance, uint32_t rx_level) {
+    // Local variables.
+    TERMINAL_status_t status = TERMINAL_SUCCESS;
+    // Check instance.
+    _TERMINAL_check_instance(instance);
+    // Check mode.
+    if (terminal_ctx[instance].flow_control == TERMINAL_FLOW_CONTROL_NONE) goto errors;
+    // Compare level to thresholds (hysteresis).
+    if ((terminal_ctx[instance].rx_stopped == 0) && (rx_level >= terminal_ctx[instance].rx_level_high)) {
+        terminal_ctx[instance].rx_stopped = 1;
+        status = _TERMINAL_set_rx_flow(instance, 0);
+        if (status != TERMINAL_SUCCESS) goto errors;
+    }
+    else if ((terminal_ctx[instance].rx_stopped != 0) && (rx_level <= terminal_ctx[instance].rx_level_low)) {
+        terminal_ctx[instance].rx_stopped = 0;
+        status = _TERMINAL_set_rx_flow(instance, 1);
+        if (status != TERMINAL_SUCCESS) goto errors;
+    }
+errors:
+    return status;
+}
+
+/*******************************************************************/
+TERMINAL_status_t TERMINAL_send_flow_control(uint8_t instance) {
+    // Local variables.
+    TERMINAL_status_t status = TERMINAL_SUCCESS;
+    // Check instance.
+    _TERMINAL_check_instance(instance);
+    // Send XON or XOFF if the sender state has been updated.
+    status = _TERMINAL_send_flow_char(instance);
+    if (status != TERMINAL_SUCCESS) goto errors;
+errors:
+    return status;
+}
+#endif
+
 #endif /* EMBEDDED_UTILS_TERMINAL_DRIVER_DISABLE */
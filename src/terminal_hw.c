@@ -13,7 +13,7 @@
 #include "terminal.h"
 #include "types.h"
 
-#if (!(defined EMBEDDED_UTILS_TERMINAL_DRIVER_DISABLE) && (EMBEDDED_UTILS_TERMINAL_INSTANCES_NUMBER > 0))
+#if (!(defined EMBEDDED_UTILS_TERMINAL_DRIVER_DISABLE) && (EMBEDDED_UTILS_TERMINAL_INSTANCES_NUMBER > 0) && !(defined EMBEDDED_UTILS_TERMINAL_HW_POSIX))
 
 /*** TERMINAL HW functions ***/
 
@@ -78,4 +78,59 @@ TERMINAL_status_t __attribute__((weak)) TERMINAL_HW_set_destination_address(uint
 }
 #endif
 
+#ifdef EMBEDDED_UTILS_TERMINAL_STATISTICS
+/*******************************************************************/
+TERMINAL_status_t __attribute__((weak)) TERMINAL_HW_get_timestamp(uint32_t* timestamp) {
+    // Local variables.
+    TERMINAL_status_t status = TERMINAL_ERROR_HW_FUNCTION_NOT_IMPLEMENTED;
+    /* To be implemented */
+    UNUSED(timestamp);
+    return status;
+}
+#endif
+
+#ifdef EMBEDDED_UTILS_TERMINAL_FLOW_CONTROL
+/*******************************************************************/
+TERMINAL_status_t __attribute__((weak)) TERMINAL_HW_set_rts(uint8_t instance, uint8_t rx_allowed) {
+    // Local variables.
+    TERMINAL_status_t status = TERMINAL_ERROR_HW_FUNCTION_NOT_IMPLEMENTED;
+    /* To be implemented */
+    UNUSED(instance);
+    UNUSED(rx_allowed);
+    return status;
+}
+
+/*******************************************************************/
+TERMINAL_status_t __attribute__((weak)) TERMINAL_HW_write_control_char(uint8_t instance, uint8_t control_char) {
+    // Local variables.
+    TERMINAL_status_t status = TERMINAL_ERROR_HW_FUNCTION_NOT_IMPLEMENTED;
+    /* To be implemented */
+    UNUSED(instance);
+    UNUSED(control_char);
+    return status;
+}
+#endif
+
+#ifdef EMBEDDED_UTILS_TERMINAL_HALF_DUPLEX
+/*******************************************************************/
+TERMINAL_status_t __attribute__((weak)) TERMINAL_HW_set_driver_enable(uint8_t instance, uint8_t tx_enable) {
+    // Local variables.
+    TERMINAL_status_t status = TERMINAL_ERROR_HW_FUNCTION_NOT_IMPLEMENTED;
+    /* To be implemented */
+    UNUSED(instance);
+    UNUSED(tx_enable);
+    return status;
+}
+
+/*******************************************************************/
+TERMINAL_status_t __attribute__((weak)) TERMINAL_HW_enable_tx_complete_irq(uint8_t instance, TERMINAL_tx_complete_irq_cb_t tx_complete_irq_callback) {
+    // Local variables.
+    TERMINAL_status_t status = TERMINAL_ERROR_HW_FUNCTION_NOT_IMPLEMENTED;
+    /* To be implemented */
+    UNUSED(instance);
+    UNUSED(tx_complete_irq_callback);
+    return status;
+}
+#endif
+
 #endif /* EMBEDDED_UTILS_TERMINAL_DRIVER_DISABLE */
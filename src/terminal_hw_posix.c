@@ -0,0 +1,488 @@
+/*
+ * terminal_hw_posix.c
+ *
+ *  Created on: 19 oct. 2026
+ *      Author: Ludo
+ */
+
+#define _GNU_SOURCE
+
+#include "terminal_hw.h"
+
+#ifndef EMBEDDED_UTILS_DISABLE_FLAGS_FILE
+#include "embedded_utils_flags.h"
+#endif
+#include "error.h"
+#include "terminal.h"
+#include "types.h"
+
+#if (!(defined EMBEDDED_UTILS_TERMINAL_DRIVER_DISABLE) && (EMBEDDED_UTILS_TERMINAL_INSTANCES_NUMBER > 0) && (defined EMBEDDED_UTILS_TERMINAL_HW_POSIX))
+
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/ioctl.h>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+
+/*** TERMINAL HW POSIX local macros ***/
+
+#define TERMINAL_HW_POSIX_DEVICE_NAME_SIZE  64
+#define TERMINAL_HW_POSIX_RX_BUFFER_SIZE    64
+#define TERMINAL_HW_POSIX_EVENTS_NUMBER     8
+
+// Epoll tag of the event used to stop the RX thread.
+#define TERMINAL_HW_POSIX_STOP_EVENT_TAG    EMBEDDED_UTILS_TERMINAL_INSTANCES_NUMBER
+
+/*** TERMINAL HW POSIX local structures ***/
+
+/*******************************************************************/
+typedef struct {
+    uint8_t opened;
+    int master_fd;
+    int slave_fd;
+    char_t device_name[TERMINAL_HW_POSIX_DEVICE_NAME_SIZE];
+    volatile uint8_t rx_enable;
+    TERMINAL_rx_irq_cb_t rx_irq_callback;
+} TERMINAL_HW_POSIX_instance_t;
+
+/*******************************************************************/
+typedef struct {
+    pthread_mutex_t mutex;
+    pthread_t rx_thread;
+    int epoll_fd;
+    int stop_fd;
+    uint8_t opened_count;
+    TERMINAL_HW_POSIX_instance_t instances[EMBEDDED_UTILS_TERMINAL_INSTANCES_NUMBER];
+} TERMINAL_HW_POSIX_context_t;
+
+/*** TERMINAL HW POSIX local global variables ***/
+
+static TERMINAL_HW_POSIX_context_t terminal_hw_posix_ctx = {
+    .mutex = PTHREAD_MUTEX_INITIALIZER,
+    .epoll_fd = -1,
+    .stop_fd = -1,
+    .opened_count = 0,
+};
+
+/*** TERMINAL HW POSIX local functions ***/
+
+/*******************************************************************/
+#define _TERMINAL_HW_POSIX_check_instance(instance) { \
+    if (instance >= EMBEDDED_UTILS_TERMINAL_INSTANCES_NUMBER) { \
+        status = TERMINAL_ERROR_INSTANCE; \
+        goto errors; \
+    } \
+}
+
+/*******************************************************************/
+#define _TERMINAL_HW_POSIX_check_opened(instance) { \
+    if (terminal_hw_posix_ctx.instances[instance].opened == 0) { \
+        status = (TERMINAL_ERROR_BASE_HW_INTERFACE + TERMINAL_HW_POSIX_ERROR_STATE); \
+        goto errors; \
+    } \
+}
+
+/*******************************************************************/
+static void* _TERMINAL_HW_POSIX_rx_thread(void* argument) {
+    // Local variables.
+    struct epoll_event events[TERMINAL_HW_POSIX_EVENTS_NUMBER];
+    uint8_t rx_buffer[TERMINAL_HW_POSIX_RX_BUFFER_SIZE];
+    TERMINAL_HW_POSIX_instance_t* instance_ptr = NULL;
+    TERMINAL_rx_irq_cb_t rx_irq_callback = NULL;
+    // Epoll instance is given by the creator since the context may already refer to a new thread when this one is stopped.
+    int epoll_fd = (int) ((intptr_t) argument);
+    int events_count = 0;
+    int available_size = 0;
+    ssize_t rx_size = 0;
+    int event_idx = 0;
+    ssize_t idx = 0;
+    // Events loop.
+    while (1) {
+        events_count = epoll_wait(epoll_fd, events, TERMINAL_HW_POSIX_EVENTS_NUMBER, -1);
+        if (events_count < 0) {
+            if (errno == EINTR) continue;
+            break;
+        }
+        for (event_idx = 0; event_idx < events_count; event_idx++) {
+            // Check stop request.
+            if (events[event_idx].data.u32 >= TERMINAL_HW_POSIX_STOP_EVENT_TAG) goto end;
+            instance_ptr = &(terminal_hw_posix_ctx.instances[events[event_idx].data.u32]);
+            rx_size = 0;
+            rx_irq_callback = NULL;
+            // Read under the mutex so that the descriptor cannot be closed or reused by a concurrent de-init.
+            // The instance may have been closed (or re-opened) since the event was returned, so that only available bytes are read.
+            pthread_mutex_lock(&(terminal_hw_posix_ctx.mutex));
+            if (((instance_ptr->opened) != 0) && (ioctl((instance_ptr->master_fd), FIONREAD, &available_size) == 0) && (available_size > 0)) {
+                rx_size = read((instance_ptr->master_fd), rx_buffer, ((available_size < TERMINAL_HW_POSIX_RX_BUFFER_SIZE) ? ((size_t) available_size) : TERMINAL_HW_POSIX_RX_BUFFER_SIZE));
+                rx_irq_callback = (instance_ptr->rx_irq_callback);
+            }
+            pthread_mutex_unlock(&(terminal_hw_posix_ctx.mutex));
+            // Emulate the byte reception interrupt.
+            for (idx = 0; idx < rx_size; idx++) {
+                if (((instance_ptr->rx_enable) != 0) && (rx_irq_callback != NULL)) {
+                    rx_irq_callback(rx_buffer[idx]);
+                }
+            }
+        }
+    }
+end:
+    return NULL;
+}
+
+/*******************************************************************/
+static TERMINAL_status_t _TERMINAL_HW_POSIX_start_rx_thread(void) {
+    // Local variables.
+    TERMINAL_status_t status = TERMINAL_SUCCESS;
+    struct epoll_event event;
+    // Create epoll instance and stop event.
+    terminal_hw_posix_ctx.epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+    terminal_hw_posix_ctx.stop_fd = eventfd(0, EFD_CLOEXEC);
+    if ((terminal_hw_posix_ctx.epoll_fd < 0) || (terminal_hw_posix_ctx.stop_fd < 0)) {
+        status = (TERMINAL_ERROR_BASE_HW_INTERFACE + TERMINAL_HW_POSIX_ERROR_RX_THREAD);
+        goto errors;
+    }
+    event.events = EPOLLIN;
+    event.data.u32 = TERMINAL_HW_POSIX_STOP_EVENT_TAG;
+    if (epoll_ctl(terminal_hw_posix_ctx.epoll_fd, EPOLL_CTL_ADD, terminal_hw_posix_ctx.stop_fd, &event) != 0) {
+        status = (TERMINAL_ERROR_BASE_HW_INTERFACE + TERMINAL_HW_POSIX_ERROR_RX_THREAD);
+        goto errors;
+    }
+    // Start thread.
+    if (pthread_create(&(terminal_hw_posix_ctx.rx_thread), NULL, &_TERMINAL_HW_POSIX_rx_thread, (void*) ((intptr_t) terminal_hw_posix_ctx.epoll_fd)) != 0) {
+        status = (TERMINAL_ERROR_BASE_HW_INTERFACE + TERMINAL_HW_POSIX_ERROR_RX_THREAD);
+        goto errors;
+    }
+    return status;
+errors:
+    if (terminal_hw_posix_ctx.stop_fd >= 0) {
+        close(terminal_hw_posix_ctx.stop_fd);
+        terminal_hw_posix_ctx.stop_fd = -1;
+    }
+    if (terminal_hw_posix_ctx.epoll_fd >= 0) {
+        close(terminal_hw_posix_ctx.epoll_fd);
+        terminal_hw_posix_ctx.epoll_fd = -1;
+    }
+    return status;
+}
+
+/*******************************************************************/
+static void _TERMINAL_HW_POSIX_stop_rx_thread(pthread_t rx_thread, int epoll_fd, int stop_fd) {
+    // Local variables.
+    uint64_t stop_request = 1;
+    // Wake up thread and wait for its end.
+    if (write(stop_fd, &stop_request, sizeof(stop_request)) == sizeof(stop_request)) {
+        pthread_join(rx_thread, NULL);
+    }
+    close(stop_fd);
+    close(epoll_fd);
+}
+
+/*** TERMINAL HW functions ***/
+
+/*******************************************************************/
+TERMINAL_status_t TERMINAL_HW_init(uint8_t instance, uint32_t baud_rate, TERMINAL_rx_irq_cb_t rx_irq_callback) {
+    // Local variables.
+    TERMINAL_status_t status = TERMINAL_SUCCESS;
+    TERMINAL_HW_POSIX_instance_t* instance_ptr = NULL;
+    struct termios attributes;
+    struct epoll_event event;
+    // Baud rate is meaningless on a pseudo-terminal.
+    UNUSED(baud_rate);
+    // Check instance.
+    _TERMINAL_HW_POSIX_check_instance(instance);
+    instance_ptr = &(terminal_hw_posix_ctx.instances[instance]);
+    pthread_mutex_lock(&(terminal_hw_posix_ctx.mutex));
+    if ((instance_ptr->opened) != 0) {
+        status = (TERMINAL_ERROR_BASE_HW_INTERFACE + TERMINAL_HW_POSIX_ERROR_STATE);
+        goto unlock;
+    }
+    // Create pseudo-terminal.
+    (instance_ptr->master_fd) = posix_openpt(O_RDWR | O_NOCTTY | O_CLOEXEC);
+    if ((instance_ptr->master_fd) < 0) {
+        status = (TERMINAL_ERROR_BASE_HW_INTERFACE + TERMINAL_HW_POSIX_ERROR_OPEN);
+        goto unlock;
+    }
+    if ((grantpt(instance_ptr->master_fd) != 0) || (unlockpt(instance_ptr->master_fd) != 0) || (ptsname_r((instance_ptr->master_fd), (instance_ptr->device_name), TERMINAL_HW_POSIX_DEVICE_NAME_SIZE) != 0)) {
+        status = (TERMINAL_ERROR_BASE_HW_INTERFACE + TERMINAL_HW_POSIX_ERROR_OPEN);
+        goto close_master;
+    }
+    // Keep the slave side opened so that the link does not hang up when the host closes it.
+    (instance_ptr->slave_fd) = open((instance_ptr->device_name), O_RDWR | O_NOCTTY | O_CLOEXEC);
+    if ((instance_ptr->slave_fd) < 0) {
+        status = (TERMINAL_ERROR_BASE_HW_INTERFACE + TERMINAL_HW_POSIX_ERROR_OPEN);
+        goto close_master;
+    }
+    // Raw mode.
+    if (tcgetattr((instance_ptr->slave_fd), &attributes) != 0) {
+        status = (TERMINAL_ERROR_BASE_HW_INTERFACE + TERMINAL_HW_POSIX_ERROR_OPEN);
+        goto close_slave;
+    }
+    cfmakeraw(&attributes);
+    if (tcsetattr((instance_ptr->slave_fd), TCSANOW, &attributes) != 0) {
+        status = (TERMINAL_ERROR_BASE_HW_INTERFACE + TERMINAL_HW_POSIX_ERROR_OPEN);
+        goto close_slave;
+    }
+    // Start RX thread on first opening.
+    if (terminal_hw_posix_ctx.opened_count == 0) {
+        status = _TERMINAL_HW_POSIX_start_rx_thread();
+        if (status != TERMINAL_SUCCESS) goto close_slave;
+    }
+    // Register instance.
+    (instance_ptr->rx_enable) = 0;
+    (instance_ptr->rx_irq_callback) = rx_irq_callback;
+    event.events = EPOLLIN;
+    event.data.u32 = instance;
+    if (epoll_ctl(terminal_hw_posix_ctx.epoll_fd, EPOLL_CTL_ADD, (instance_ptr->master_fd), &event) != 0) {
+        status = (TERMINAL_ERROR_BASE_HW_INTERFACE + TERMINAL_HW_POSIX_ERROR_RX_THREAD);
+        // The new thread has no registered instance, so that it can not wait for the mutex.
+        if (terminal_hw_posix_ctx.opened_count == 0) {
+            _TERMINAL_HW_POSIX_stop_rx_thread(terminal_hw_posix_ctx.rx_thread, terminal_hw_posix_ctx.epoll_fd, terminal_hw_posix_ctx.stop_fd);
+            terminal_hw_posix_ctx.epoll_fd = -1;
+            terminal_hw_posix_ctx.stop_fd = -1;
+        }
+        goto close_slave;
+    }
+    (instance_ptr->opened) = 1;
+    terminal_hw_posix_ctx.opened_count++;
+    goto unlock;
+close_slave:
+    close(instance_ptr->slave_fd);
+close_master:
+    close(instance_ptr->master_fd);
+unlock:
+    pthread_mutex_unlock(&(terminal_hw_posix_ctx.mutex));
+errors:
+    return status;
+}
+
+/*******************************************************************/
+TERMINAL_status_t TERMINAL_HW_de_init(uint8_t instance) {
+    // Local variables.
+    TERMINAL_status_t status = TERMINAL_SUCCESS;
+    TERMINAL_HW_POSIX_instance_t* instance_ptr = NULL;
+    pthread_t rx_thread;
+    int epoll_fd = -1;
+    int stop_fd = -1;
+    uint8_t stop_flag = 0;
+    // Check instance.
+    _TERMINAL_HW_POSIX_check_instance(instance);
+    instance_ptr = &(terminal_hw_posix_ctx.instances[instance]);
+    pthread_mutex_lock(&(terminal_hw_posix_ctx.mutex));
+    if ((instance_ptr->opened) == 0) {
+        status = (TERMINAL_ERROR_BASE_HW_INTERFACE + TERMINAL_HW_POSIX_ERROR_STATE);
+        goto unlock;
+    }
+    // Unregister instance.
+    (instance_ptr->rx_enable) = 0;
+    epoll_ctl(terminal_hw_posix_ctx.epoll_fd, EPOLL_CTL_DEL, (instance_ptr->master_fd), NULL);
+    (instance_ptr->opened) = 0;
+    terminal_hw_posix_ctx.opened_count--;
+    // Release pseudo-terminal while the RX thread can not read it.
+    close(instance_ptr->slave_fd);
+    close(instance_ptr->master_fd);
+    // Detach RX thread after last closing.
+    if (terminal_hw_posix_ctx.opened_count == 0) {
+        rx_thread = terminal_hw_posix_ctx.rx_thread;
+        epoll_fd = terminal_hw_posix_ctx.epoll_fd;
+        stop_fd = terminal_hw_posix_ctx.stop_fd;
+        terminal_hw_posix_ctx.epoll_fd = -1;
+        terminal_hw_posix_ctx.stop_fd = -1;
+        stop_flag = 1;
+    }
+unlock:
+    pthread_mutex_unlock(&(terminal_hw_posix_ctx.mutex));
+    // Stop RX thread outside of the critical section since it may be waiting for the mutex.
+    if (stop_flag != 0) {
+        _TERMINAL_HW_POSIX_stop_rx_thread(rx_thread, epoll_fd, stop_fd);
+    }
+errors:
+    return status;
+}
+
+/*******************************************************************/
+TERMINAL_status_t TERMINAL_HW_enable_rx(uint8_t instance) {
+    // Local variables.
+    TERMINAL_status_t status = TERMINAL_SUCCESS;
+    // Check instance.
+    _TERMINAL_HW_POSIX_check_instance(instance);
+    _TERMINAL_HW_POSIX_check_opened(instance);
+    // Enable callback.
+    terminal_hw_posix_ctx.instances[instance].rx_enable = 1;
+errors:
+    return status;
+}
+
+/*******************************************************************/
+TERMINAL_status_t TERMINAL_HW_disable_rx(uint8_t instance) {
+    // Local variables.
+    TERMINAL_status_t status = TERMINAL_SUCCESS;
+    // Check instance.
+    _TERMINAL_HW_POSIX_check_instance(instance);
+    _TERMINAL_HW_POSIX_check_opened(instance);
+    // Disable callback (received bytes are discarded as on a disabled UART).
+    terminal_hw_posix_ctx.instances[instance].rx_enable = 0;
+errors:
+    return status;
+}
+
+/*******************************************************************/
+TERMINAL_status_t TERMINAL_HW_write(uint8_t instance, uint8_t* data, uint32_t data_size_bytes) {
+    // Local variables.
+    TERMINAL_status_t status = TERMINAL_SUCCESS;
+    ssize_t tx_size = 0;
+    uint32_t idx = 0;
+    // Check instance.
+    _TERMINAL_HW_POSIX_check_instance(instance);
+    _TERMINAL_HW_POSIX_check_opened(instance);
+    // Blocking write.
+    while (idx < data_size_bytes) {
+        tx_size = write(terminal_hw_posix_ctx.instances[instance].master_fd, &(data[idx]), (size_t) (data_size_bytes - idx));
+        if (tx_size < 0) {
+            if (errno == EINTR) continue;
+            status = (TERMINAL_ERROR_BASE_HW_INTERFACE + TERMINAL_HW_POSIX_ERROR_WRITE);
+            goto errors;
+        }
+        idx += (uint32_t) tx_size;
+    }
+errors:
+    return status;
+}
+
+#ifdef EMBEDDED_UTILS_TERMINAL_MODE_BUS
+/*******************************************************************/
+TERMINAL_status_t TERMINAL_HW_set_destination_address(uint8_t instance, uint8_t destination_address) {
+    // Local variables.
+    TERMINAL_status_t status = TERMINAL_SUCCESS;
+    // Pseudo-terminals are point to point links: nothing to do.
+    UNUSED(destination_address);
+    // Check instance.
+    _TERMINAL_HW_POSIX_check_instance(instance);
+    _TERMINAL_HW_POSIX_check_opened(instance);
+errors:
+    return status;
+}
+#endif
+
+#ifdef EMBEDDED_UTILS_TERMINAL_HALF_DUPLEX
+/*******************************************************************/
+TERMINAL_status_t TERMINAL_HW_set_driver_enable(uint8_t instance, uint8_t tx_enable) {
+    // Local variables.
+    TERMINAL_status_t status = TERMINAL_SUCCESS;
+    // Pseudo-terminals are full duplex: nothing to drive.
+    UNUSED(tx_enable);
+    // Check instance.
+    _TERMINAL_HW_POSIX_check_instance(instance);
+    _TERMINAL_HW_POSIX_check_opened(instance);
+errors:
+    return status;
+}
+
+/*******************************************************************/
+TERMINAL_status_t TERMINAL_HW_enable_tx_complete_irq(uint8_t instance, TERMINAL_tx_complete_irq_cb_t tx_complete_irq_callback) {
+    // Local variables.
+    TERMINAL_status_t status = TERMINAL_SUCCESS;
+    // Check parameters.
+    _TERMINAL_HW_POSIX_check_instance(instance);
+    _TERMINAL_HW_POSIX_check_opened(instance);
+    if (tx_complete_irq_callback == NULL) {
+        status = TERMINAL_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    // Data is already in the kernel buffer when the blocking write returns.
+    tx_complete_irq_callback(instance);
+errors:
+    return status;
+}
+#endif
+
+#ifdef EMBEDDED_UTILS_TERMINAL_FLOW_CONTROL
+/*******************************************************************/
+TERMINAL_status_t TERMINAL_HW_set_rts(uint8_t instance, uint8_t rx_allowed) {
+    // Local variables.
+    TERMINAL_status_t status = TERMINAL_SUCCESS;
+    struct epoll_event event;
+    int result = 0;
+    // Check instance.
+    _TERMINAL_HW_POSIX_check_instance(instance);
+    _TERMINAL_HW_POSIX_check_opened(instance);
+    // Pseudo-terminals have no modem lines: stop reading the master side so that the host is blocked by the kernel buffer.
+    event.events = EPOLLIN;
+    event.data.u32 = instance;
+    result = epoll_ctl(terminal_hw_posix_ctx.epoll_fd, ((rx_allowed != 0) ? EPOLL_CTL_ADD : EPOLL_CTL_DEL), terminal_hw_posix_ctx.instances[instance].master_fd, &event);
+    if ((result != 0) && (errno != EEXIST) && (errno != ENOENT)) {
+        status = (TERMINAL_ERROR_BASE_HW_INTERFACE + TERMINAL_HW_POSIX_ERROR_RX_THREAD);
+        goto errors;
+    }
+errors:
+    return status;
+}
+
+/*******************************************************************/
+TERMINAL_status_t TERMINAL_HW_write_control_char(uint8_t instance, uint8_t control_char) {
+    // Local variables.
+    TERMINAL_status_t status = TERMINAL_SUCCESS;
+    ssize_t tx_size = 0;
+    // Check instance.
+    _TERMINAL_HW_POSIX_check_instance(instance);
+    _TERMINAL_HW_POSIX_check_opened(instance);
+    // Single byte writes are atomic on the master side.
+    do {
+        tx_size = write(terminal_hw_posix_ctx.instances[instance].master_fd, &control_char, 1);
+    }
+    while ((tx_size < 0) && (errno == EINTR));
+    if (tx_size != 1) {
+        status = (TERMINAL_ERROR_BASE_HW_INTERFACE + TERMINAL_HW_POSIX_ERROR_WRITE);
+        goto errors;
+    }
+errors:
+    return status;
+}
+#endif
+
+#ifdef EMBEDDED_UTILS_TERMINAL_STATISTICS
+/*******************************************************************/
+TERMINAL_status_t TERMINAL_HW_get_timestamp(uint32_t* timestamp) {
+    // Local variables.
+    TERMINAL_status_t status = TERMINAL_SUCCESS;
+    struct timespec now;
+    // Check parameters.
+    if (timestamp == NULL) {
+        status = TERMINAL_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    // Monotonic time in microseconds.
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    (*timestamp) = (uint32_t) ((((uint64_t) now.tv_sec) * 1000000) + (((uint64_t) now.tv_nsec) / 1000));
+errors:
+    return status;
+}
+#endif
+
+/*******************************************************************/
+TERMINAL_status_t TERMINAL_HW_POSIX_get_device_name(uint8_t instance, char_t** device_name) {
+    // Local variables.
+    TERMINAL_status_t status = TERMINAL_SUCCESS;
+    // Check parameters.
+    _TERMINAL_HW_POSIX_check_instance(instance);
+    _TERMINAL_HW_POSIX_check_opened(instance);
+    if (device_name == NULL) {
+        status = TERMINAL_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    (*device_name) = terminal_hw_posix_ctx.instances[instance].device_name;
+errors:
+    return status;
+}
+
+/*** TERMINAL HW POSIX compilation flags check ***/
+
+#if (EMBEDDED_UTILS_HW_INTERFACE_ERROR_BASE_LAST < ERROR_BASE_STEP)
+#error "embedded-utils: HW interface error base too small for POSIX terminal errors"
+#endif
+
+#endif /* EMBEDDED_UTILS_TERMINAL_HW_POSIX */
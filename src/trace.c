@@ -0,0 +1,310 @@
+/*
+ * trace.c
+ *
+ *  Created on: 19 oct. 2026
+ *      Author: Ludo
+ */
+
+#include "trace.h"
+
+#ifndef EMBEDDED_UTILS_DISABLE_FLAGS_FILE
+#include "embedded_utils_flags.h"
+#endif
+#include "cobs.h"
+#include "error.h"
+#include "strings.h"
+#include "terminal.h"
+#include "types.h"
+
+#if (!(defined EMBEDDED_UTILS_TRACE_DRIVER_DISABLE) && (EMBEDDED_UTILS_TRACE_BUFFER_DEPTH > 0))
+
+/*** TRACE local macros ***/
+
+#define TRACE_QUEUE_SIZE            (EMBEDDED_UTILS_TRACE_BUFFER_DEPTH + 1)
+
+#define TRACE_FRAME_HEADER_SIZE     7
+#define TRACE_FRAME_DATA_SIZE_MAX   (TRACE_FRAME_HEADER_SIZE + (TRACE_ARGUMENTS_NUMBER_MAX << 2))
+#define TRACE_FRAME_SIZE_MAX        COBS_FRAME_SIZE_MAX(TRACE_FRAME_DATA_SIZE_MAX)
+
+#define TRACE_TEXT_ARGUMENT_MARKER  '%'
+#define TRACE_TEXT_UNKNOWN_FORMAT   "#"
+#define TRACE_TEXT_LINE_END         "\r\n"
+#define TRACE_TEXT_FIELD_SIZE_MAX   16
+
+/*** TRACE local structures ***/
+
+/*******************************************************************/
+typedef struct {
+    uint32_t timestamp;
+    uint16_t format_id;
+    uint8_t arguments_count;
+    uint32_t arguments[TRACE_ARGUMENTS_NUMBER_MAX];
+    volatile uint8_t ready_flag;
+} TRACE_event_t;
+
+/*******************************************************************/
+typedef struct {
+    uint8_t terminal_instance;
+    TRACE_output_mode_t output_mode;
+    TRACE_get_timestamp_cb_t get_timestamp_callback;
+    TRACE_critical_section_cb_t enter_critical_section_callback;
+    TRACE_critical_section_cb_t exit_critical_section_callback;
+    const char_t* const* format_table;
+    uint16_t format_table_size;
+    TRACE_event_t events[TRACE_QUEUE_SIZE];
+    volatile uint32_t write_idx;
+    volatile uint32_t read_idx;
+    volatile uint32_t lost_events_count;
+} TRACE_context_t;
+
+/*** TRACE local global variables ***/
+
+static TRACE_context_t trace_ctx;
+
+/*** TRACE local functions ***/
+
+/*******************************************************************/
+#define _TRACE_enter_critical_section(void) { if (trace_ctx.enter_critical_section_callback != NULL) trace_ctx.enter_critical_section_callback(); }
+
+/*******************************************************************/
+#define _TRACE_exit_critical_section(void) { if (trace_ctx.exit_critical_section_callback != NULL) trace_ctx.exit_critical_section_callback(); }
+
+/*******************************************************************/
+#define _TRACE_write_u32(frame, idx, value) { \
+    frame[idx++] = (uint8_t) (((value) >> 0) & 0xFF); \
+    frame[idx++] = (uint8_t) (((value) >> 8) & 0xFF); \
+    frame[idx++] = (uint8_t) (((value) >> 16) & 0xFF); \
+    frame[idx++] = (uint8_t) (((value) >> 24) & 0xFF); \
+}
+
+/*******************************************************************/
+static TRACE_status_t _TRACE_send_binary_event(TRACE_event_t* event) {
+    // Local variables.
+    TRACE_status_t status = TRACE_SUCCESS;
+    TERMINAL_status_t terminal_status = TERMINAL_SUCCESS;
+    COBS_status_t cobs_status = COBS_SUCCESS;
+    uint8_t frame_data[TRACE_FRAME_DATA_SIZE_MAX];
+    uint8_t frame[TRACE_FRAME_SIZE_MAX];
+    uint32_t frame_data_idx = 0;
+    uint32_t frame_size = 0;
+    uint8_t idx = 0;
+    // Build frame data (little endian).
+    frame_data[frame_data_idx++] = (uint8_t) (((event->format_id) >> 0) & 0xFF);
+    frame_data[frame_data_idx++] = (uint8_t) (((event->format_id) >> 8) & 0xFF);
+    frame_data[frame_data_idx++] = (event->arguments_count);
+    _TRACE_write_u32(frame_data, frame_data_idx, (event->timestamp));
+    for (idx = 0; idx < (event->arguments_count); idx++) {
+        _TRACE_write_u32(frame_data, frame_data_idx, (event->arguments)[idx]);
+    }
+    // Encode frame so that the host can resynchronize on the delimiter.
+    cobs_status = COBS_encode(frame, TRACE_FRAME_SIZE_MAX, frame_data, frame_data_idx, &frame_size);
+    COBS_exit_error(TRACE_ERROR_BASE_COBS);
+    // Send frame without using the terminal buffer, which may contain data of another user.
+    terminal_status = TERMINAL_send_data(trace_ctx.terminal_instance, frame, frame_size);
+    TERMINAL_exit_error(TRACE_ERROR_BASE_TERMINAL);
+errors:
+    return status;
+}
+
+/*******************************************************************/
+static TRACE_status_t _TRACE_send_text(const char_t* str, uint32_t size) {
+    // Local variables.
+    TRACE_status_t status = TRACE_SUCCESS;
+    TERMINAL_status_t terminal_status = TERMINAL_SUCCESS;
+    // Check size.
+    if (size == 0) goto errors;
+    // Send text without using the terminal buffer, which may contain data of another user.
+    terminal_status = TERMINAL_send_data(trace_ctx.terminal_instance, (uint8_t*) str, size);
+    TERMINAL_exit_error(TRACE_ERROR_BASE_TERMINAL);
+errors:
+    return status;
+}
+
+/*******************************************************************/
+static TRACE_status_t _TRACE_send_integer(int32_t value, STRING_format_t format, uint8_t print_prefix) {
+    // Local variables.
+    TRACE_status_t status = TRACE_SUCCESS;
+    STRING_status_t string_status = STRING_SUCCESS;
+    char_t field[TRACE_TEXT_FIELD_SIZE_MAX];
+    uint32_t field_size = 0;
+    // Convert value.
+    string_status = STRING_append_integer(field, TRACE_TEXT_FIELD_SIZE_MAX, value, format, print_prefix, &field_size);
+    STRING_exit_error(TRACE_ERROR_BASE_STRING);
+    status = _TRACE_send_text(field, field_size);
+errors:
+    return status;
+}
+
+/*******************************************************************/
+static TRACE_status_t _TRACE_send_text_event(TRACE_event_t* event) {
+    // Local variables.
+    TRACE_status_t status = TRACE_SUCCESS;
+    STRING_status_t string_status = STRING_SUCCESS;
+    char_t field[TRACE_TEXT_FIELD_SIZE_MAX];
+    uint32_t field_size = 0;
+    const char_t* format = NULL;
+    uint8_t argument_idx = 0;
+    uint32_t start_idx = 0;
+    uint32_t idx = 0;
+    // Print timestamp (unsigned, it may exceed the signed range after a long uptime).
+    string_status = STRING_append_format(field, TRACE_TEXT_FIELD_SIZE_MAX, &field_size, "[%lu] ", (unsigned long) (event->timestamp));
+    STRING_exit_error(TRACE_ERROR_BASE_STRING);
+    status = _TRACE_send_text(field, field_size);
+    if (status != TRACE_SUCCESS) goto errors;
+    // Check format ID.
+    if (((event->format_id) < trace_ctx.format_table_size) && (trace_ctx.format_table != NULL)) {
+        format = trace_ctx.format_table[event->format_id];
+    }
+    if (format == NULL) {
+        // Print raw ID and arguments.
+        status = _TRACE_send_text(TRACE_TEXT_UNKNOWN_FORMAT, (sizeof(TRACE_TEXT_UNKNOWN_FORMAT) - 1));
+        if (status != TRACE_SUCCESS) goto errors;
+        status = _TRACE_send_integer((int32_t) (event->format_id), STRING_FORMAT_DECIMAL, 0);
+        if (status != TRACE_SUCCESS) goto errors;
+        for (argument_idx = 0; argument_idx < (event->arguments_count); argument_idx++) {
+            status = _TRACE_send_text(" ", 1);
+            if (status != TRACE_SUCCESS) goto errors;
+            status = _TRACE_send_integer((int32_t) (event->arguments)[argument_idx], STRING_FORMAT_HEXADECIMAL, 1);
+            if (status != TRACE_SUCCESS) goto errors;
+        }
+    }
+    else {
+        // Send literal runs directly and replace %d and %x markers by the arguments.
+        while (format[idx] != STRING_CHAR_NULL) {
+            if ((format[idx] == TRACE_TEXT_ARGUMENT_MARKER) && ((format[idx + 1] == 'd') || (format[idx + 1] == 'x')) && (argument_idx < (event->arguments_count))) {
+                status = _TRACE_send_text(&(format[start_idx]), (idx - start_idx));
+                if (status != TRACE_SUCCESS) goto errors;
+                status = _TRACE_send_integer((int32_t) (event->arguments)[argument_idx], ((format[idx + 1] == 'd') ? STRING_FORMAT_DECIMAL : STRING_FORMAT_HEXADECIMAL), 0);
+                if (status != TRACE_SUCCESS) goto errors;
+                argument_idx++;
+                idx += 2;
+                start_idx = idx;
+            }
+            else {
+                idx++;
+            }
+        }
+        status = _TRACE_send_text(&(format[start_idx]), (idx - start_idx));
+        if (status != TRACE_SUCCESS) goto errors;
+    }
+    status = _TRACE_send_text(TRACE_TEXT_LINE_END, (sizeof(TRACE_TEXT_LINE_END) - 1));
+errors:
+    return status;
+}
+
+/*** TRACE functions ***/
+
+/*******************************************************************/
+TRACE_status_t TRACE_init(TRACE_configuration_t* configuration) {
+    // Local variables.
+    TRACE_status_t status = TRACE_SUCCESS;
+    uint32_t idx = 0;
+    // Check parameters.
+    if (configuration == NULL) {
+        status = TRACE_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    if ((configuration->output_mode) >= TRACE_OUTPUT_MODE_LAST) {
+        status = TRACE_ERROR_OUTPUT_MODE;
+        goto errors;
+    }
+    // Init context.
+    trace_ctx.terminal_instance = (configuration->terminal_instance);
+    trace_ctx.output_mode = (configuration->output_mode);
+    trace_ctx.get_timestamp_callback = (configuration->get_timestamp_callback);
+    trace_ctx.enter_critical_section_callback = (configuration->enter_critical_section_callback);
+    trace_ctx.exit_critical_section_callback = (configuration->exit_critical_section_callback);
+    trace_ctx.format_table = (configuration->format_table);
+    trace_ctx.format_table_size = (configuration->format_table_size);
+    trace_ctx.write_idx = 0;
+    trace_ctx.read_idx = 0;
+    trace_ctx.lost_events_count = 0;
+    for (idx = 0; idx < TRACE_QUEUE_SIZE; idx++) {
+        trace_ctx.events[idx].ready_flag = 0;
+    }
+errors:
+    return status;
+}
+
+/*******************************************************************/
+void TRACE_log(uint16_t format_id, uint8_t arguments_count, uint32_t argument_1, uint32_t argument_2, uint32_t argument_3, uint32_t argument_4) {
+    // Local variables.
+    uint32_t write_idx = 0;
+    uint32_t next_write_idx = 0;
+    uint32_t timestamp = 0;
+    TRACE_event_t* event = NULL;
+    // Claim a slot atomically since the function can be called from both main context and interrupts.
+    _TRACE_enter_critical_section();
+    write_idx = trace_ctx.write_idx;
+    next_write_idx = (write_idx + 1);
+    // Manage roll-over.
+    if (next_write_idx >= TRACE_QUEUE_SIZE) {
+        next_write_idx = 0;
+    }
+    // Check free space.
+    if (next_write_idx == trace_ctx.read_idx) {
+        trace_ctx.lost_events_count++;
+        _TRACE_exit_critical_section();
+        goto errors;
+    }
+    trace_ctx.write_idx = next_write_idx;
+    // Read timestamp within the critical section so that events are ordered.
+    timestamp = (trace_ctx.get_timestamp_callback != NULL) ? trace_ctx.get_timestamp_callback() : 0;
+    _TRACE_exit_critical_section();
+    // Store raw event in the claimed slot.
+    event = &(trace_ctx.events[write_idx]);
+    (event->timestamp) = timestamp;
+    (event->format_id) = format_id;
+    (event->arguments_count) = (arguments_count > TRACE_ARGUMENTS_NUMBER_MAX) ? TRACE_ARGUMENTS_NUMBER_MAX : arguments_count;
+    (event->arguments)[0] = argument_1;
+    (event->arguments)[1] = argument_2;
+    (event->arguments)[2] = argument_3;
+    (event->arguments)[3] = argument_4;
+    // Publish event.
+    (event->ready_flag) = 1;
+errors:
+    return;
+}
+
+/*******************************************************************/
+uint32_t TRACE_get_lost_events_count(void) {
+    return (trace_ctx.lost_events_count);
+}
+
+/*******************************************************************/
+TRACE_status_t TRACE_process(void) {
+    // Local variables.
+    TRACE_status_t status = TRACE_SUCCESS;
+    uint32_t read_idx = trace_ctx.read_idx;
+    // Events loop.
+    while (read_idx != trace_ctx.write_idx) {
+        // Stop on a claimed slot which is still being filled by an interrupted producer.
+        if (trace_ctx.events[read_idx].ready_flag == 0) break;
+        // Send event.
+        if (trace_ctx.output_mode == TRACE_OUTPUT_MODE_BINARY) {
+            status = _TRACE_send_binary_event(&(trace_ctx.events[read_idx]));
+        }
+        else {
+            status = _TRACE_send_text_event(&(trace_ctx.events[read_idx]));
+        }
+        // Release event even if it could not be sent.
+        trace_ctx.events[read_idx].ready_flag = 0;
+        read_idx = ((read_idx + 1) % TRACE_QUEUE_SIZE);
+        trace_ctx.read_idx = read_idx;
+        if (status != TRACE_SUCCESS) goto errors;
+    }
+errors:
+    return status;
+}
+
+/*** TRACE compilation flags check ***/
+
+#if (EMBEDDED_UTILS_TERMINAL_INSTANCES_NUMBER == 0)
+#error "embedded-utils: Terminal instance missing for TRACE driver"
+#endif
+
+#ifdef EMBEDDED_UTILS_COBS_DRIVER_DISABLE
+#error "embedded-utils: COBS driver required by TRACE driver"
+#endif
+
+#endif /* EMBEDDED_UTILS_TRACE_DRIVER_DISABLE */